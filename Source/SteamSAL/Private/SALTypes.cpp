@@ -2,5 +2,88 @@
 #pragma once
 
 #include "SALTypes.h"
+#include "SAL_LeaderboardEntryStore.h"
 
 DEFINE_LOG_CATEGORY(LogSteamSAL);
+
+int32 FSAL_LeaderboardEntriesData::Num() const
+{
+	return Store.IsValid() ? Store->Num() : Entries.Num();
+}
+
+bool FSAL_LeaderboardEntriesData::GetRow(int32 Index, FSAL_LeaderboardEntryRow& OutRow) const
+{
+	if (Store.IsValid())
+	{
+		if (!Store->IsValidIndex(Index))
+		{
+			return false;
+		}
+
+		Store->BuildRow(Index, OutRow);
+		return true;
+	}
+
+	if (!Entries.IsValidIndex(Index))
+	{
+		return false;
+	}
+
+	OutRow = Entries[Index];
+	return true;
+}
+
+uint64 FSAL_LeaderboardEntriesData::GetSteamID64(int32 Index) const
+{
+	if (Store.IsValid())
+	{
+		return Store->IsValidIndex(Index) ? Store->GetSteamID(Index) : 0;
+	}
+
+	uint64 Raw64 = 0;
+	if (Entries.IsValidIndex(Index))
+	{
+		LexFromString(Raw64, *Entries[Index].SteamID);
+	}
+	return Raw64;
+}
+
+int32 FSAL_LeaderboardEntriesData::GetGlobalRank(int32 Index) const
+{
+	if (Store.IsValid())
+	{
+		return Store->IsValidIndex(Index) ? Store->GetGlobalRank(Index) : 0;
+	}
+	return Entries.IsValidIndex(Index) ? Entries[Index].GlobalRank : 0;
+}
+
+int32 FSAL_LeaderboardEntriesData::GetScore(int32 Index) const
+{
+	if (Store.IsValid())
+	{
+		return Store->IsValidIndex(Index) ? Store->GetScore(Index) : 0;
+	}
+	return Entries.IsValidIndex(Index) ? Entries[Index].Score : 0;
+}
+
+FSAL_LeaderboardEntryStorePtr FSAL_LeaderboardEntriesData::GetOrBuildStore() const
+{
+	if (Store.IsValid())
+	{
+		return Store;
+	}
+
+	FSAL_LeaderboardEntryStorePtr Built = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+	Built->Reserve(Entries.Num());
+
+	for (const FSAL_LeaderboardEntryRow& Row : Entries)
+	{
+		uint64 Raw64 = 0;
+		LexFromString(Raw64, *Row.SteamID);
+
+		Built->AddRow(Raw64, Row.GlobalRank, Row.Score, static_cast<uint64>(Row.UGCHandle.Value),
+		              Row.Details.GetData(), Row.Details.Num(), FStringView(*Row.PlayerName, Row.PlayerName.Len()));
+	}
+
+	return Built;
+}
@@ -2,6 +2,7 @@
 
 
 #include "SAL_CreateLeaderboard.h"
+#include "SAL_LeaderboardRegistrySubsystem.h"
 
 USAL_CreateLeaderboard* USAL_CreateLeaderboard::CreateLeaderboard(UObject* WorldContextObject,
 	const FString& LeaderboardName, ESALLeaderboardSortMethod SortMethod, ESALLeaderboardDisplayType DisplayType)
@@ -94,6 +95,8 @@ void USAL_CreateLeaderboard::OnCreateLeaderboardCompleted(LeaderboardFindResult_
 	UE_LOG(LogTemp, Log, TEXT("[SAL] CreateLeaderboard: success '%s' (Handle=%lld)"),
 		*InLeaderboardName, Handle.Value);
 
+	USAL_LeaderboardRegistrySubsystem::RecordFromCallback(WorldContextObject, InLeaderboardName, Handle);
+
 	OnSuccess.Broadcast(Handle);
 	SetReadyToDestroy();
 }
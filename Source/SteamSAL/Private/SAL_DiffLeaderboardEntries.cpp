@@ -0,0 +1,151 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_DiffLeaderboardEntries.h"
+#include "SAL_Internal.h"
+#include "SAL_LeaderboardEntryStore.h"
+
+void USAL_DiffLeaderboardEntries::Diff(const FSAL_LeaderboardEntryStore& Old, const FSAL_LeaderboardEntryStore& New,
+                                       FIndexDiff& Out)
+{
+	TMap<uint64, int32> OldIndexBySteamID;
+	OldIndexBySteamID.Reserve(Old.Num());
+
+	for (int32 i = 0; i < Old.Num(); ++i)
+	{
+		OldIndexBySteamID.Add(Old.GetSteamID(i), i);
+	}
+
+	TBitArray<> Matched(false, Old.Num());
+
+	for (int32 NewIndex = 0; NewIndex < New.Num(); ++NewIndex)
+	{
+		const int32* OldIndexPtr = OldIndexBySteamID.Find(New.GetSteamID(NewIndex));
+		if (OldIndexPtr == nullptr)
+		{
+			Out.Entered.Add(NewIndex);
+			continue;
+		}
+
+		const int32 OldIndex = *OldIndexPtr;
+		Matched[OldIndex] = true;
+
+		if (Old.GetGlobalRank(OldIndex) != New.GetGlobalRank(NewIndex))
+		{
+			Out.RankChanged.Emplace(OldIndex, NewIndex);
+		}
+
+		if (Old.GetScore(OldIndex) != New.GetScore(NewIndex))
+		{
+			Out.ScoreChanged.Emplace(OldIndex, NewIndex);
+		}
+	}
+
+	for (int32 OldIndex = 0; OldIndex < Old.Num(); ++OldIndex)
+	{
+		if (!Matched[OldIndex])
+		{
+			Out.Left.Add(OldIndex);
+		}
+	}
+}
+
+USAL_DiffLeaderboardEntries* USAL_DiffLeaderboardEntries::DiffLeaderboardEntries(
+	UObject* WorldContextObject, const FSAL_LeaderboardEntriesData& OldEntries, const FSAL_LeaderboardEntriesData& NewEntries)
+{
+	USAL_DiffLeaderboardEntries* Node = NewObject<USAL_DiffLeaderboardEntries>();
+
+	Node->RegisterWithGameInstance(WorldContextObject);
+
+	Node->OldStore = OldEntries.GetOrBuildStore();
+	Node->NewStore = NewEntries.GetOrBuildStore();
+
+	return Node;
+}
+
+void USAL_DiffLeaderboardEntries::Activate()
+{
+	TWeakObjectPtr<USAL_DiffLeaderboardEntries> Self(this);
+	FSAL_LeaderboardEntryStorePtr Old = OldStore;
+	FSAL_LeaderboardEntryStorePtr New = NewStore;
+
+	// Only SteamID, rank and score are read off the GameThread; those columns never change after download.
+	Async(EAsyncExecution::ThreadPool, [Self, Old, New]()
+	{
+		TSharedPtr<FIndexDiff> IndexDiff = MakeShared<FIndexDiff>();
+		Diff(*Old, *New, *IndexDiff);
+
+		SAL_RunOnGameThread([Self, IndexDiff]()
+		{
+			if (!Self.IsValid()) return;
+			Self->OnDiffReady(*IndexDiff);
+		});
+	});
+}
+
+static FSAL_LeaderboardDiffRow SAL_MakeDiffRow(const FSAL_LeaderboardEntryStore* Old, int32 OldIndex,
+                                               const FSAL_LeaderboardEntryStore* New, int32 NewIndex)
+{
+	FSAL_LeaderboardDiffRow Row;
+
+	const FSAL_LeaderboardEntryStore& Named = New ? *New : *Old;
+	const int32 NamedIndex = New ? NewIndex : OldIndex;
+	const FStringView Name = Named.GetPlayerName(NamedIndex);
+
+	Row.SteamID    = LexToString(Named.GetSteamID(NamedIndex));
+	Row.PlayerName = FString(Name.Len(), Name.GetData());
+
+	if (Old)
+	{
+		Row.OldRank  = Old->GetGlobalRank(OldIndex);
+		Row.OldScore = Old->GetScore(OldIndex);
+	}
+
+	if (New)
+	{
+		Row.NewRank  = New->GetGlobalRank(NewIndex);
+		Row.NewScore = New->GetScore(NewIndex);
+	}
+
+	if (Old && New)
+	{
+		Row.RankDelta  = Row.OldRank - Row.NewRank;
+		Row.ScoreDelta = Row.NewScore - Row.OldScore;
+	}
+
+	return Row;
+}
+
+void USAL_DiffLeaderboardEntries::OnDiffReady(const FIndexDiff& IndexDiff)
+{
+	FSAL_LeaderboardDiff Result;
+	Result.Entered.Reserve(IndexDiff.Entered.Num());
+	Result.Left.Reserve(IndexDiff.Left.Num());
+	Result.RankChanged.Reserve(IndexDiff.RankChanged.Num());
+	Result.ScoreChanged.Reserve(IndexDiff.ScoreChanged.Num());
+
+	for (const int32 NewIndex : IndexDiff.Entered)
+	{
+		Result.Entered.Add(SAL_MakeDiffRow(nullptr, INDEX_NONE, NewStore.Get(), NewIndex));
+	}
+
+	for (const int32 OldIndex : IndexDiff.Left)
+	{
+		Result.Left.Add(SAL_MakeDiffRow(OldStore.Get(), OldIndex, nullptr, INDEX_NONE));
+	}
+
+	for (const TPair<int32, int32>& Pair : IndexDiff.RankChanged)
+	{
+		Result.RankChanged.Add(SAL_MakeDiffRow(OldStore.Get(), Pair.Key, NewStore.Get(), Pair.Value));
+	}
+
+	for (const TPair<int32, int32>& Pair : IndexDiff.ScoreChanged)
+	{
+		Result.ScoreChanged.Add(SAL_MakeDiffRow(OldStore.Get(), Pair.Key, NewStore.Get(), Pair.Value));
+	}
+
+	OldStore.Reset();
+	NewStore.Reset();
+
+	OnCompleted.Broadcast(Result);
+	SetReadyToDestroy();
+}
@@ -2,12 +2,15 @@
 
 
 #include "SAL_DownloadLeaderboardEntries.h"
-#include "Misc/EngineVersionComparison.h"
 #include "SAL_Internal.h"
+#include "SAL_LeaderboardChangeProbe.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_LeaderboardSnapshotSubsystem.h"
+#include "SAL_PersonaResolverSubsystem.h"
 
 USAL_DownloadLeaderboardEntries* USAL_DownloadLeaderboardEntries::DownloadLeaderboardEntries(
 	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle, ELeaderboardRequestType RequestType,
-	int32 RangeStart, int32 RangeEnd)
+	int32 RangeStart, int32 RangeEnd, int32 ConversionBudgetMicroseconds, int32 DetailsMax, bool bRefreshIfChanged)
 {
 	USAL_DownloadLeaderboardEntries* Node = NewObject<USAL_DownloadLeaderboardEntries>();
 
@@ -18,7 +21,9 @@ USAL_DownloadLeaderboardEntries* USAL_DownloadLeaderboardEntries::DownloadLeader
 	Node->InRequestType = RequestType;
 	Node->InRangeStart = RangeStart;
 	Node->InRangeEnd = RangeEnd;
-	Node->InDetailsMax = 64;
+	Node->InDetailsMax = FMath::Clamp(DetailsMax, 0, 64);
+	Node->InConversionBudgetMicroseconds = FMath::Max(ConversionBudgetMicroseconds, 0);
+	Node->bInRefreshIfChanged = bRefreshIfChanged;
 
 	return Node;
 }
@@ -43,169 +48,94 @@ void USAL_DownloadLeaderboardEntries::Activate()
 		return;
 	}
 
-	ELeaderboardDataRequest DataRequest = k_ELeaderboardDataRequestGlobal;
-	switch (InRequestType)
+	if (bInRefreshIfChanged)
 	{
-	case ELeaderboardRequestType::Global:
-		DataRequest = k_ELeaderboardDataRequestGlobal;
-		break;
+		const FSAL_LeaderboardQueryKey Key(InHandle, InRequestType, InRangeStart, InRangeEnd, InDetailsMax);
+		TWeakObjectPtr<USAL_DownloadLeaderboardEntries> Self(this);
 
-	case ELeaderboardRequestType::GlobalAroundUser:
-		DataRequest = k_ELeaderboardDataRequestGlobalAroundUser;
-		break;
+		const bool bProbing = FSAL_LeaderboardChangeProbe::Get(WorldContextObject).Probe(Key,
+			[Self](bool bUnchanged, const FSAL_LeaderboardEntriesData& Remembered)
+			{
+				if (!Self.IsValid()) return;
+
+				if (bUnchanged)
+				{
+					Self->OnEntriesDownloaded(true, Remembered, FString());
+				}
+				else
+				{
+					Self->StartDownload();
+				}
+			});
+
+		if (bProbing)
+		{
+			return;
+		}
+	}
 
-	case ELeaderboardRequestType::Friends:
-		DataRequest = k_ELeaderboardDataRequestFriends;
-		break;
+	StartDownload();
+}
 
-	default:
-		DataRequest = k_ELeaderboardDataRequestGlobal;
-		break;
-	}
+void USAL_DownloadLeaderboardEntries::StartDownload()
+{
+	const FSAL_LeaderboardQueryKey Key(InHandle, InRequestType, InRangeStart, InRangeEnd, InDetailsMax);
 
-	SteamLeaderboard_t SteamHandle = static_cast<SteamLeaderboard_t>(InHandle.Value);
+	TWeakObjectPtr<USAL_DownloadLeaderboardEntries> Self(this);
+	FString Error;
 
-	const int32 Start = (InRequestType == ELeaderboardRequestType::Friends) ? 0 : InRangeStart;
-	const int32 End = (InRequestType == ELeaderboardRequestType::Friends) ? 0 : InRangeEnd;
+	const bool bRequested = FSAL_LeaderboardDownloadCoalescer::Get().Request(Key,
+		[Self, Key](bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Why)
+		{
+			if (!Self.IsValid()) return;
+
+			if (bOk && Self->bInRefreshIfChanged)
+			{
+				FSAL_LeaderboardChangeProbe::Get(Self->WorldContextObject).Remember(Key, EntriesData);
+			}
 
-	SteamAPICall_t APICall = SteamUserStats()->DownloadLeaderboardEntries(
-		SteamHandle,
-		DataRequest,
-		Start,
-		End
-	);
+			Self->OnEntriesDownloaded(bOk, EntriesData, Why);
+		},
+		Error,
+		InConversionBudgetMicroseconds);
 
-	if (APICall == k_uAPICallInvalid)
+	if (!bRequested)
 	{
-		Fail(TEXT("Steam returned an invalid API call handle."));
-		return;
+		Fail(Error);
 	}
-
-	CallResult.Set(APICall, this, &USAL_DownloadLeaderboardEntries::OnScoresDownloaded);
 }
 
-void USAL_DownloadLeaderboardEntries::OnScoresDownloaded(LeaderboardScoresDownloaded_t* Callback, bool bIOFailure)
+void USAL_DownloadLeaderboardEntries::OnEntriesDownloaded(bool bOk, const FSAL_LeaderboardEntriesData& EntriesData,
+                                                          const FString& Error)
 {
-	if (bIOFailure || Callback == nullptr)
+	if (!bOk)
 	{
-		Fail(TEXT("Steam leaderboard download failed (IO failure)."));
+		OnFailure.Broadcast(Error);
+		SetReadyToDestroy();
 		return;
 	}
 
-	if (SteamUserStats() == nullptr)
+	if (USAL_PersonaResolverSubsystem* Resolver = USAL_PersonaResolverSubsystem::Get(WorldContextObject))
 	{
-		Fail(TEXT("SteamUserStats not available in callback."));
-		return;
-	}
-
-	FSAL_LeaderboardEntriesData EntriesData;
-	EntriesData.RequestType = InRequestType;
-	EntriesData.TotalEntryCount = Callback->m_cEntryCount;
-
-	if (Callback->m_cEntryCount > 0)
-	{
-		EntriesData.Entries.Reserve(Callback->m_cEntryCount);
-	}
-
-	if (Callback->m_cEntryCount <= 0)
-	{
-		TWeakObjectPtr<USAL_DownloadLeaderboardEntries> Self(this);
-
-		SAL_RunOnGameThread([Self, EntriesData]()
-		{
-			if (!Self.IsValid()) return;
-			const int32 EntryCount = EntriesData.Entries.Num();
-			Self->OnSuccess.Broadcast(EntriesData, EntryCount);
-			Self->SetReadyToDestroy();
-		});
-
-		return;
+		Resolver->Track(EntriesData);
 	}
 
-	for (int32 i = 0; i < Callback->m_cEntryCount; ++i)
+	if (USAL_LeaderboardSnapshotSubsystem* Snapshots = USAL_LeaderboardSnapshotSubsystem::Get(WorldContextObject))
 	{
-		LeaderboardEntry_t Entry;
-
-		TArray<int32> DetailsBuffer;
-		int32* DetailsPtr = nullptr;
-
-		if (InDetailsMax > 0)
-		{
-			DetailsBuffer.SetNumUninitialized(InDetailsMax);
-			DetailsPtr = DetailsBuffer.GetData();
-		}
-
-		const bool bGot = SteamUserStats()->GetDownloadedLeaderboardEntry(
-			Callback->m_hSteamLeaderboardEntries,
-			i,
-			&Entry,
-			DetailsPtr,
-			InDetailsMax
-		);
-
-		if (!bGot)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[SteamSAL] Failed to get entry %d"), i);
-			continue;
-		}
-
-		FSAL_LeaderboardEntryRow Row;
-		Row.SteamID = LexToString(Entry.m_steamIDUser.ConvertToUint64());
-		Row.GlobalRank = Entry.m_nGlobalRank;
-		Row.Score = Entry.m_nScore;
-		
-		const uint64 RawUGC = static_cast<uint64>(Entry.m_hUGC);
-
-		if (RawUGC == 0 || RawUGC == k_UGCHandleInvalid)
-		{
-			Row.UGCHandle.Value = 0;
-			Row.bHasUGC         = false;
-		}
-		else
-		{
-			Row.UGCHandle.Value = static_cast<int64>(RawUGC);
-			Row.bHasUGC         = true;
-		}
-
-		if (SteamFriends())
-		{
-			const char* Nick = SteamFriends()->GetFriendPersonaName(Entry.m_steamIDUser);
-			Row.PlayerName = Nick ? UTF8_TO_TCHAR(Nick) : TEXT("");
-
-			if (Row.PlayerName.IsEmpty())
-			{
-				SteamFriends()->RequestUserInformation(Entry.m_steamIDUser, true);
-			}
-		}
-
-		if (InDetailsMax > 0)
-		{
-			const int32 ActualDetails = FMath::Min(Entry.m_cDetails, InDetailsMax);
-
-#if UE_VERSION_OLDER_THAN(5, 4, 0)
-			DetailsBuffer.SetNum(ActualDetails, false);
-#else
-			DetailsBuffer.SetNum(ActualDetails, EAllowShrinking::No);
-#endif
-
-			Row.Details = MoveTemp(DetailsBuffer);
-		}
-
-		EntriesData.Entries.Add(MoveTemp(Row));
+		Snapshots->AutoSnapshot(FSAL_LeaderboardQueryKey(InHandle, InRequestType, InRangeStart, InRangeEnd, InDetailsMax), EntriesData);
 	}
 
-	TWeakObjectPtr<USAL_DownloadLeaderboardEntries> Self(this);
-
-	SAL_RunOnGameThread([Self, EntriesData = MoveTemp(EntriesData)]() mutable
-	{
-		if (!Self.IsValid()) return;
-
-		const int32 EntryCount = EntriesData.Entries.Num();
-		Self->OnSuccess.Broadcast(EntriesData, EntryCount);
-		Self->SetReadyToDestroy();
-	});
+	const int32 EntryCount = EntriesData.Num();
+	OnSuccess.Broadcast(EntriesData, EntryCount);
+	SetReadyToDestroy();
 }
 
+void USAL_DownloadLeaderboardEntries::GetRefreshProbeStats(UObject* WorldContextObject, int32& Probes, int32& SkippedDownloads)
+{
+	const FSAL_LeaderboardChangeProbe& Probe = FSAL_LeaderboardChangeProbe::Get(WorldContextObject);
+	Probes = Probe.GetNumProbes();
+	SkippedDownloads = Probe.GetNumSkipped();
+}
 
 void USAL_DownloadLeaderboardEntries::Fail(const FString& Why)
 {
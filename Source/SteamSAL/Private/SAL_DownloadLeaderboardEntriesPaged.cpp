@@ -0,0 +1,179 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_DownloadLeaderboardEntriesPaged.h"
+#include "SAL_Internal.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_PersonaResolverSubsystem.h"
+
+USAL_DownloadLeaderboardEntriesPaged* USAL_DownloadLeaderboardEntriesPaged::DownloadLeaderboardEntriesPaged(
+	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle, ELeaderboardRequestType RequestType,
+	int32 RangeStart, int32 RangeEnd, int32 PageSize, int32 MaxPagesInFlight, int32 DetailsMax)
+{
+	USAL_DownloadLeaderboardEntriesPaged* Node = NewObject<USAL_DownloadLeaderboardEntriesPaged>();
+
+	Node->RegisterWithGameInstance(WorldContextObject);
+
+	Node->WorldContextObject = WorldContextObject;
+	Node->InHandle = LeaderboardHandle;
+	Node->InRequestType = RequestType;
+	Node->InRangeStart = RangeStart;
+	Node->InRangeEnd = RangeEnd;
+	Node->InPageSize = FMath::Max(PageSize, 1);
+	Node->InMaxPagesInFlight = FMath::Max(MaxPagesInFlight, 1);
+	Node->InDetailsMax = FMath::Clamp(DetailsMax, 0, 64);
+
+	return Node;
+}
+
+void USAL_DownloadLeaderboardEntriesPaged::Activate()
+{
+	if (InHandle.Value == 0)
+	{
+		Fail(TEXT("Invalid LeaderboardHandle. Make sure FindLeaderboard succeeded."));
+		return;
+	}
+
+	if (SteamUserStats() == nullptr)
+	{
+		Fail(TEXT("SteamUserStats not available or not initialized."));
+		return;
+	}
+
+	if (InRequestType == ELeaderboardRequestType::Friends)
+	{
+		NumPages = 1;
+	}
+	else
+	{
+		if (InRangeEnd < InRangeStart)
+		{
+			Fail(FString::Printf(TEXT("Invalid range [%d..%d]."), InRangeStart, InRangeEnd));
+			return;
+		}
+
+		const int64 RangeCount = static_cast<int64>(InRangeEnd) - InRangeStart + 1;
+		NumPages = static_cast<int32>((RangeCount + InPageSize - 1) / InPageSize);
+	}
+
+	IssuePages();
+}
+
+void USAL_DownloadLeaderboardEntriesPaged::IssuePages()
+{
+	while (!bFinished && !bReachedEnd && NextPageToIssue < NumPages && NumPagesInFlight < InMaxPagesInFlight)
+	{
+		if (!IssuePage(NextPageToIssue))
+		{
+			return;
+		}
+
+		++NextPageToIssue;
+	}
+}
+
+bool USAL_DownloadLeaderboardEntriesPaged::IssuePage(int32 PageIndex)
+{
+	int32 Start = 0;
+	int32 End = 0;
+
+	if (InRequestType != ELeaderboardRequestType::Friends)
+	{
+		Start = InRangeStart + PageIndex * InPageSize;
+		End = FMath::Min(InRangeEnd, Start + InPageSize - 1);
+	}
+
+	const FSAL_LeaderboardQueryKey Key(InHandle, InRequestType, Start, End, InDetailsMax);
+	const int32 RequestedCount = End - Start + 1;
+
+	TWeakObjectPtr<USAL_DownloadLeaderboardEntriesPaged> Self(this);
+	FString Error;
+
+	const bool bRequested = FSAL_LeaderboardDownloadCoalescer::Get().Request(Key,
+		[Self, PageIndex, RequestedCount](bool bOk, const FSAL_LeaderboardEntriesData& PageData, const FString& Why)
+		{
+			if (!Self.IsValid()) return;
+
+			if (!bOk)
+			{
+				Self->Fail(FString::Printf(TEXT("Page %d: %s"), PageIndex, *Why));
+				return;
+			}
+
+			Self->OnPageConverted(PageIndex, PageData, RequestedCount);
+		},
+		Error);
+
+	if (!bRequested)
+	{
+		Fail(FString::Printf(TEXT("Page %d: %s"), PageIndex, *Error));
+		return false;
+	}
+
+	++NumPagesInFlight;
+	return true;
+}
+
+void USAL_DownloadLeaderboardEntriesPaged::OnPageConverted(int32 PageIndex, const FSAL_LeaderboardEntriesData& PageData,
+                                                           int32 RequestedCount)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	--NumPagesInFlight;
+	++NumPagesDelivered;
+
+	const int32 PageCount = PageData.Num();
+	TotalDelivered += PageCount;
+
+	// A short Global page means the board ended; later pages would come back empty.
+	if (InRequestType == ELeaderboardRequestType::Global && PageCount < RequestedCount)
+	{
+		bReachedEnd = true;
+	}
+
+	const int32 PageFirstRank = (PageCount > 0) ? PageData.GetGlobalRank(0) : 0;
+
+	if (USAL_PersonaResolverSubsystem* Resolver = USAL_PersonaResolverSubsystem::Get(WorldContextObject))
+	{
+		Resolver->Track(PageData);
+	}
+
+	OnPage.Broadcast(PageData, PageIndex, PageFirstRank);
+
+	IssuePages();
+
+	if (!bFinished && NumPagesDelivered == NextPageToIssue && (bReachedEnd || NextPageToIssue >= NumPages))
+	{
+		Finish();
+	}
+}
+
+void USAL_DownloadLeaderboardEntriesPaged::Finish()
+{
+	bFinished = true;
+
+	OnCompleted.Broadcast(TotalDelivered);
+	SetReadyToDestroy();
+}
+
+void USAL_DownloadLeaderboardEntriesPaged::Fail(const FString& Why)
+{
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	const FString WhyCopy = Why;
+	TWeakObjectPtr<USAL_DownloadLeaderboardEntriesPaged> Self(this);
+
+	SAL_RunOnGameThread([Self, WhyCopy]()
+	{
+		if (!Self.IsValid()) return;
+		Self->OnFailure.Broadcast(WhyCopy);
+		Self->SetReadyToDestroy();
+	});
+}
@@ -2,10 +2,13 @@
 
 #include "SAL_DownloadLeaderboardForUsers.h"
 #include "SAL_Internal.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_MyLeaderboardEntrySubsystem.h"
+#include "SAL_PersonaResolverSubsystem.h"
 
 USAL_DownloadLeaderboardForUsers* USAL_DownloadLeaderboardForUsers::DownloadEntriesForUsers(
 	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle,
-	const TArray<FString>& SteamIDs)
+	const TArray<FString>& SteamIDs, int32 DetailsMax)
 {
 	USAL_DownloadLeaderboardForUsers* Node = NewObject<USAL_DownloadLeaderboardForUsers>();
 
@@ -14,6 +17,7 @@ USAL_DownloadLeaderboardForUsers* USAL_DownloadLeaderboardForUsers::DownloadEntr
 	Node->WorldContextObject     = WorldContextObject;
 	Node->InHandle               = LeaderboardHandle;
 	Node->InSteamId64Strings     = SteamIDs;
+	Node->InDetailsMax           = FMath::Clamp(DetailsMax, 0, 64);
 
 	return Node;
 }
@@ -44,6 +48,12 @@ void USAL_DownloadLeaderboardForUsers::Activate()
 	constexpr int32 kMaxUsers = 100;
 	const int32 CountClamped = FMath::Min(InSteamId64Strings.Num(), kMaxUsers);
 
+	if (InSteamId64Strings.Num() > kMaxUsers)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] DownloadEntriesForUsers: %d users requested, only the first %d are downloaded. Use 'Download Steam Leaderboard Entries (Users, Sharded)' for larger lists."),
+		       InSteamId64Strings.Num(), kMaxUsers);
+	}
+
 	TArray<CSteamID> SteamIDs;
 	SteamIDs.Reserve(CountClamped);
 
@@ -120,83 +130,37 @@ void USAL_DownloadLeaderboardForUsers::OnScoresDownloaded(LeaderboardScoresDownl
 	FSAL_LeaderboardEntriesData EntriesData;
 	EntriesData.RequestType     = ELeaderboardRequestType::Global;
 	EntriesData.TotalEntryCount = Callback->m_cEntryCount;
+	EntriesData.Store           = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
 
 	if (Callback->m_cEntryCount > 0)
 	{
-		EntriesData.Entries.Reserve(Callback->m_cEntryCount);
+		EntriesData.Store->ReserveForDownload(Callback->m_cEntryCount, InDetailsMax);
+		EntriesData.Store->AppendFromSteam(
+			Callback->m_hSteamLeaderboardEntries,
+			0,
+			Callback->m_cEntryCount,
+			InDetailsMax
+		);
 	}
 
-	if (Callback->m_cEntryCount <= 0)
-	{
-		TWeakObjectPtr<USAL_DownloadLeaderboardForUsers> Self(this);
+	const int32 EntryCount = EntriesData.Num();
 
-		SAL_RunOnGameThread([Self, EntriesData]()
-		{
-			if (!Self.IsValid()) return;
-			Self->OnSuccess.Broadcast(EntriesData, 0);
-			Self->SetReadyToDestroy();
-		});
-
-		return;
-	}
-
-	LeaderboardEntry_t RawEntry;
-	int32 DetailBuffer[64];
+	TWeakObjectPtr<USAL_DownloadLeaderboardForUsers> Self(this);
 
-	for (int32 i = 0; i < Callback->m_cEntryCount; ++i)
+	SAL_RunOnGameThread([Self, EntriesData = MoveTemp(EntriesData), EntryCount]() mutable
 	{
-		if (SteamUserStats()->GetDownloadedLeaderboardEntry(
-			Callback->m_hSteamLeaderboardEntries,
-			i,
-			&RawEntry,
-			DetailBuffer,
-			UE_ARRAY_COUNT(DetailBuffer)))
+		if (!Self.IsValid()) return;
+
+		if (USAL_PersonaResolverSubsystem* Resolver = USAL_PersonaResolverSubsystem::Get(Self->WorldContextObject))
 		{
-			FSAL_LeaderboardEntryRow Row;
-			Row.SteamID    = FString::Printf(TEXT("%llu"), RawEntry.m_steamIDUser.ConvertToUint64());
-			Row.GlobalRank = RawEntry.m_nGlobalRank;
-			Row.Score      = RawEntry.m_nScore;
-
-			const uint64 RawUGC = static_cast<uint64>(RawEntry.m_hUGC);
-
-			if (RawUGC == 0 || RawUGC == k_UGCHandleInvalid)
-			{
-				Row.UGCHandle.Value = 0;
-				Row.bHasUGC         = false;
-			}
-			else
-			{
-				Row.UGCHandle.Value = static_cast<int64>(RawUGC);
-				Row.bHasUGC         = true;
-			}
-			
-			if (SteamFriends())
-			{
-				const char* Persona = SteamFriends()->GetFriendPersonaName(RawEntry.m_steamIDUser);
-				Row.PlayerName = Persona ? UTF8_TO_TCHAR(Persona) : TEXT("");
-
-				if (Row.PlayerName.IsEmpty())
-				{
-					SteamFriends()->RequestUserInformation(RawEntry.m_steamIDUser, true);
-				}
-			}
-
-			for (int32 d = 0; d < RawEntry.m_cDetails; ++d)
-			{
-				Row.Details.Add(DetailBuffer[d]);
-			}
-
-			EntriesData.Entries.Add(Row);
+			Resolver->Track(EntriesData);
 		}
-	}
-
-	const int32 EntryCount = EntriesData.Entries.Num();
 
-	TWeakObjectPtr<USAL_DownloadLeaderboardForUsers> Self(this);
+		if (USAL_MyLeaderboardEntrySubsystem* MyEntry = USAL_MyLeaderboardEntrySubsystem::Get(Self->WorldContextObject))
+		{
+			MyEntry->AddEntries(Self->InHandle.Value, EntriesData);
+		}
 
-	SAL_RunOnGameThread([Self, EntriesData, EntryCount]() mutable
-	{
-		if (!Self.IsValid()) return;
 		Self->OnSuccess.Broadcast(EntriesData, EntryCount);
 		Self->SetReadyToDestroy();
 	});
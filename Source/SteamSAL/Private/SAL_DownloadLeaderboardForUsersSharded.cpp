@@ -0,0 +1,258 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_DownloadLeaderboardForUsersSharded.h"
+#include "SAL_Internal.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_MyLeaderboardEntrySubsystem.h"
+#include "SAL_PersonaResolverSubsystem.h"
+
+USAL_DownloadLeaderboardForUsersSharded* USAL_DownloadLeaderboardForUsersSharded::DownloadEntriesForUsersSharded(
+	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle,
+	const TArray<FString>& SteamIDs, int32 MaxConcurrentShards, int32 DetailsMax)
+{
+	USAL_DownloadLeaderboardForUsersSharded* Node = NewObject<USAL_DownloadLeaderboardForUsersSharded>();
+
+	Node->RegisterWithGameInstance(WorldContextObject);
+
+	Node->WorldContextObject     = WorldContextObject;
+	Node->InHandle               = LeaderboardHandle;
+	Node->InSteamId64Strings     = SteamIDs;
+	Node->InMaxConcurrentShards  = FMath::Max(MaxConcurrentShards, 1);
+	Node->InDetailsMax           = FMath::Clamp(DetailsMax, 0, 64);
+
+	return Node;
+}
+
+void USAL_DownloadLeaderboardForUsersSharded::Activate()
+{
+	if (InHandle.Value == 0)
+	{
+		Fail(TEXT("[SAL] DownloadEntriesForUsersSharded: Invalid LeaderboardHandle"));
+		return;
+	}
+
+	if (SteamUserStats() == nullptr)
+	{
+		Fail(TEXT("[SAL] DownloadEntriesForUsersSharded: SteamUserStats not available"));
+		return;
+	}
+
+	if (InSteamId64Strings.Num() <= 0)
+	{
+		Fail(TEXT("[SAL] DownloadEntriesForUsersSharded: Empty user list"));
+		return;
+	}
+
+	TSet<uint64> Seen;
+	Seen.Reserve(InSteamId64Strings.Num());
+	SteamIDs.Reserve(InSteamId64Strings.Num());
+
+	for (const FString& S : InSteamId64Strings)
+	{
+		uint64 Raw64 = 0;
+		if (!LexTryParseString<uint64>(Raw64, *S))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] DownloadEntriesForUsersSharded: Bad SteamID64 string '%s' (skipped)"), *S);
+			continue;
+		}
+
+		const CSteamID Cid((uint64)Raw64);
+		if (!Cid.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] DownloadEntriesForUsersSharded: Invalid SteamID64 '%s' (skipped)"), *S);
+			continue;
+		}
+
+		// A user requested by two shards would show up twice in the merged result.
+		bool bAlreadySeen = false;
+		Seen.Add(Raw64, &bAlreadySeen);
+		if (!bAlreadySeen)
+		{
+			SteamIDs.Add(Cid);
+		}
+	}
+
+	if (SteamIDs.Num() <= 0)
+	{
+		Fail(TEXT("[SAL] DownloadEntriesForUsersSharded: No valid Steam IDs after parsing"));
+		return;
+	}
+
+	NumShards = (SteamIDs.Num() + kUsersPerShard - 1) / kUsersPerShard;
+
+	ShardResults.SetNum(NumShards);
+	ShardStores.SetNum(NumShards);
+	ShardCalls.SetNum(NumShards);
+
+	for (int32 i = 0; i < NumShards; ++i)
+	{
+		ShardResults[i].ShardIndex = i;
+		ShardResults[i].UserCount  = FMath::Min(kUsersPerShard, SteamIDs.Num() - i * kUsersPerShard);
+	}
+
+	IssueShards();
+}
+
+void USAL_DownloadLeaderboardForUsersSharded::IssueShards()
+{
+	while (NextShardToIssue < NumShards && NumShardsInFlight < InMaxConcurrentShards)
+	{
+		IssueShard(NextShardToIssue++);
+	}
+}
+
+void USAL_DownloadLeaderboardForUsersSharded::IssueShard(int32 ShardIndex)
+{
+	if (SteamUserStats() == nullptr)
+	{
+		OnShardDone(ShardIndex, nullptr, TEXT("SteamUserStats not available"));
+		return;
+	}
+
+	const int32 First = ShardIndex * kUsersPerShard;
+
+	SteamAPICall_t ApiCall = SteamUserStats()->DownloadLeaderboardEntriesForUsers(
+		(SteamLeaderboard_t)InHandle.Value,
+		SteamIDs.GetData() + First,
+		ShardResults[ShardIndex].UserCount
+	);
+
+	if (ApiCall == k_uAPICallInvalid)
+	{
+		OnShardDone(ShardIndex, nullptr, TEXT("DownloadLeaderboardEntriesForUsers returned invalid call handle"));
+		return;
+	}
+
+	++NumShardsInFlight;
+
+	TWeakObjectPtr<USAL_DownloadLeaderboardForUsersSharded> Self(this);
+
+	ShardCalls[ShardIndex] = MakeUnique<TSAL_PendingCall<LeaderboardScoresDownloaded_t>>();
+	const int32 DetailsMax = InDetailsMax;
+
+	ShardCalls[ShardIndex]->Set(ApiCall, [Self, ShardIndex, DetailsMax](LeaderboardScoresDownloaded_t* Callback, bool bIOFailure)
+	{
+		FSAL_LeaderboardEntryStorePtr Store;
+		FString Error;
+
+		if (bIOFailure || Callback == nullptr)
+		{
+			Error = TEXT("IO failure or null callback");
+		}
+		else if (SteamUserStats() == nullptr)
+		{
+			Error = TEXT("SteamUserStats unavailable in callback");
+		}
+		else
+		{
+			Store = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+
+			if (Callback->m_cEntryCount > 0)
+			{
+				Store->ReserveForDownload(Callback->m_cEntryCount, DetailsMax);
+				Store->AppendFromSteam(Callback->m_hSteamLeaderboardEntries, 0, Callback->m_cEntryCount, DetailsMax);
+			}
+		}
+
+		SAL_RunOnGameThread([Self, ShardIndex, Store, Error]()
+		{
+			if (!Self.IsValid()) return;
+			Self->OnShardDone(ShardIndex, Store, Error);
+		});
+	});
+}
+
+void USAL_DownloadLeaderboardForUsersSharded::OnShardDone(int32 ShardIndex, const FSAL_LeaderboardEntryStorePtr& Store,
+                                                          const FString& Error)
+{
+	FSAL_LeaderboardShardResult& Result = ShardResults[ShardIndex];
+	Result.bOk        = Store.IsValid();
+	Result.Error      = Error;
+	Result.EntryCount = Store.IsValid() ? Store->Num() : 0;
+
+	if (!Result.bOk)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] DownloadEntriesForUsersSharded: Shard %d failed: %s"), ShardIndex, *Error);
+	}
+
+	ShardStores[ShardIndex] = Store;
+
+	// Shards that failed before reaching Steam never counted as in flight.
+	if (ShardCalls[ShardIndex].IsValid())
+	{
+		--NumShardsInFlight;
+	}
+
+	++NumShardsDone;
+
+	if (NumShardsDone == NumShards)
+	{
+		Finish();
+		return;
+	}
+
+	IssueShards();
+}
+
+void USAL_DownloadLeaderboardForUsersSharded::Finish()
+{
+	int32 TotalRows = 0;
+	int32 NumOk = 0;
+
+	for (const FSAL_LeaderboardEntryStorePtr& Store : ShardStores)
+	{
+		if (Store.IsValid())
+		{
+			TotalRows += Store->Num();
+			++NumOk;
+		}
+	}
+
+	if (NumOk == 0)
+	{
+		Fail(FString::Printf(TEXT("[SAL] DownloadEntriesForUsersSharded: All %d shards failed (first error: %s)"),
+		                     NumShards, *ShardResults[0].Error));
+		return;
+	}
+
+	FSAL_LeaderboardEntriesData EntriesData;
+	EntriesData.RequestType = ELeaderboardRequestType::Global;
+	EntriesData.Store       = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+	EntriesData.Store->Reserve(TotalRows);
+
+	for (const FSAL_LeaderboardEntryStorePtr& Store : ShardStores)
+	{
+		if (Store.IsValid())
+		{
+			EntriesData.Store->Append(*Store);
+		}
+	}
+
+	EntriesData.Store->SortByGlobalRank();
+	EntriesData.TotalEntryCount = EntriesData.Store->Num();
+
+	ShardStores.Empty();
+	ShardCalls.Empty();
+
+	if (USAL_PersonaResolverSubsystem* Resolver = USAL_PersonaResolverSubsystem::Get(WorldContextObject))
+	{
+		Resolver->Track(EntriesData);
+	}
+
+	if (USAL_MyLeaderboardEntrySubsystem* MyEntry = USAL_MyLeaderboardEntrySubsystem::Get(WorldContextObject))
+	{
+		MyEntry->AddEntries(InHandle.Value, EntriesData);
+	}
+
+	OnSuccess.Broadcast(EntriesData, EntriesData.Num(), ShardResults);
+	SetReadyToDestroy();
+}
+
+void USAL_DownloadLeaderboardForUsersSharded::Fail(const FString& Why)
+{
+	ShardStores.Empty();
+	ShardCalls.Empty();
+
+	OnFailure.Broadcast(Why, ShardResults);
+	SetReadyToDestroy();
+}
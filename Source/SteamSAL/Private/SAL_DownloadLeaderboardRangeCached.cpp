@@ -0,0 +1,76 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_DownloadLeaderboardRangeCached.h"
+#include "SAL_LeaderboardCacheSubsystem.h"
+#include "SAL_PersonaResolverSubsystem.h"
+
+USAL_DownloadLeaderboardRangeCached* USAL_DownloadLeaderboardRangeCached::DownloadLeaderboardRangeCached(
+	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle, int32 RangeStart, int32 RangeEnd,
+	int32 DetailsMax)
+{
+	USAL_DownloadLeaderboardRangeCached* Node = NewObject<USAL_DownloadLeaderboardRangeCached>();
+
+	Node->RegisterWithGameInstance(WorldContextObject);
+
+	Node->WorldContextObject = WorldContextObject;
+	Node->InHandle = LeaderboardHandle;
+	Node->InRangeStart = RangeStart;
+	Node->InRangeEnd = RangeEnd;
+	Node->InDetailsMax = FMath::Clamp(DetailsMax, 0, 64);
+
+	return Node;
+}
+
+void USAL_DownloadLeaderboardRangeCached::Activate()
+{
+	if (InHandle.Value == 0)
+	{
+		OnFailure.Broadcast(TEXT("Invalid LeaderboardHandle. Make sure FindLeaderboard succeeded."));
+		SetReadyToDestroy();
+		return;
+	}
+
+	if (InRangeStart < 1 || InRangeEnd < InRangeStart)
+	{
+		OnFailure.Broadcast(FString::Printf(TEXT("Invalid range [%d..%d]. Global ranks start at 1."), InRangeStart, InRangeEnd));
+		SetReadyToDestroy();
+		return;
+	}
+
+	USAL_LeaderboardCacheSubsystem* Cache = USAL_LeaderboardCacheSubsystem::Get(WorldContextObject);
+	if (Cache == nullptr)
+	{
+		OnFailure.Broadcast(TEXT("Leaderboard cache not available (no GameInstance)."));
+		SetReadyToDestroy();
+		return;
+	}
+
+	TWeakObjectPtr<USAL_DownloadLeaderboardRangeCached> Self(this);
+
+	Cache->RequestGlobalRange(InHandle, InRangeStart, InRangeEnd, InDetailsMax,
+		[Self](bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Why)
+		{
+			if (!Self.IsValid()) return;
+			Self->OnRangeReady(bOk, EntriesData, Why);
+		},
+		&NumDownloads);
+}
+
+void USAL_DownloadLeaderboardRangeCached::OnRangeReady(bool bOk, const FSAL_LeaderboardEntriesData& EntriesData,
+                                                       const FString& Error)
+{
+	if (!bOk)
+	{
+		OnFailure.Broadcast(Error);
+		SetReadyToDestroy();
+		return;
+	}
+
+	if (USAL_PersonaResolverSubsystem* Resolver = USAL_PersonaResolverSubsystem::Get(WorldContextObject))
+	{
+		Resolver->Track(EntriesData);
+	}
+
+	OnSuccess.Broadcast(EntriesData, EntriesData.Num(), NumDownloads);
+	SetReadyToDestroy();
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_EstimateLeaderboardPercentile.h"
+#include "SAL_PercentileEstimatorSubsystem.h"
+
+USAL_EstimateLeaderboardPercentile* USAL_EstimateLeaderboardPercentile::EstimateLeaderboardPercentile(
+	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle, int32 Score, int32 NumSamples,
+	int32 RefineSamples)
+{
+	USAL_EstimateLeaderboardPercentile* Node = NewObject<USAL_EstimateLeaderboardPercentile>();
+
+	Node->RegisterWithGameInstance(WorldContextObject);
+
+	Node->WorldContextObject = WorldContextObject;
+	Node->InHandle = LeaderboardHandle;
+	Node->InScore = Score;
+	Node->InNumSamples = NumSamples;
+	Node->InRefineSamples = RefineSamples;
+
+	return Node;
+}
+
+void USAL_EstimateLeaderboardPercentile::Activate()
+{
+	if (InHandle.Value == 0)
+	{
+		OnFailure.Broadcast(TEXT("Invalid LeaderboardHandle. Make sure FindLeaderboard succeeded."));
+		SetReadyToDestroy();
+		return;
+	}
+
+	USAL_PercentileEstimatorSubsystem* Estimator = USAL_PercentileEstimatorSubsystem::Get(WorldContextObject);
+	if (Estimator == nullptr)
+	{
+		OnFailure.Broadcast(TEXT("Percentile estimator not available (no GameInstance)."));
+		SetReadyToDestroy();
+		return;
+	}
+
+	TWeakObjectPtr<USAL_EstimateLeaderboardPercentile> Self(this);
+
+	Estimator->Estimate(InHandle, InScore, InNumSamples, InRefineSamples,
+		[Self](bool bOk, const USAL_PercentileEstimatorSubsystem::FEstimate& Estimate, const FString& Error)
+		{
+			if (!Self.IsValid()) return;
+
+			if (bOk)
+			{
+				Self->OnSuccess.Broadcast(Estimate.TopPercent, Estimate.Rank, Estimate.BestRank, Estimate.WorstRank,
+				                          Estimate.TotalEntries);
+			}
+			else
+			{
+				Self->OnFailure.Broadcast(Error);
+			}
+
+			Self->SetReadyToDestroy();
+		});
+}
@@ -2,6 +2,7 @@
 
 
 #include "SAL_FindLeaderboard.h"
+#include "SAL_LeaderboardRegistrySubsystem.h"
 #include "Async/Async.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/Engine.h"
@@ -81,6 +82,9 @@ void USAL_FindLeaderboard::OnFindLeaderboardCompleted(LeaderboardFindResult_t* R
 	HandleWrapper.Value = static_cast<int64>(Result->m_hSteamLeaderboard);
 
 	UE_LOG(LogTemp, Log, TEXT("[SAL] FindLeaderboard: found '%s' (Handle=%lld)"), *InLeaderboardName, HandleWrapper.Value);
+
+	USAL_LeaderboardRegistrySubsystem::RecordFromCallback(WorldContextObject, InLeaderboardName, HandleWrapper);
+
 	OnSuccess.Broadcast(HandleWrapper);
 
 	SetReadyToDestroy();
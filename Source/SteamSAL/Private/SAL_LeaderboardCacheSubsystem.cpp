@@ -0,0 +1,471 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardCacheSubsystem.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_LeaderboardSnapshotSubsystem.h"
+#include "SAL_PersonaResolverSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+USAL_LeaderboardCacheSubsystem* USAL_LeaderboardCacheSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_LeaderboardCacheSubsystem>() : nullptr;
+}
+
+void USAL_LeaderboardCacheSubsystem::Deinitialize()
+{
+	ClearCache();
+
+	Super::Deinitialize();
+}
+
+bool USAL_LeaderboardCacheSubsystem::GetEntries(FSAL_LeaderboardHandle LeaderboardHandle,
+                                                ELeaderboardRequestType RequestType, int32 RangeStart, int32 RangeEnd,
+                                                FSAL_LeaderboardEntriesData& EntriesData, bool& bIsStale,
+                                                int32 DetailsMax)
+{
+	EntriesData = FSAL_LeaderboardEntriesData();
+	EntriesData.RequestType = RequestType;
+	bIsStale = true;
+
+	if (LeaderboardHandle.Value == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardCache: Invalid LeaderboardHandle"));
+		return false;
+	}
+
+	const FSAL_LeaderboardQueryKey Key(LeaderboardHandle, RequestType, RangeStart, RangeEnd, DetailsMax);
+	const double Now = FPlatformTime::Seconds();
+
+	FCachedQuery* Cached = Cache.Find(Key);
+	if (Cached == nullptr)
+	{
+		++NumMisses;
+
+		// Serve the last snapshot from disk as stale rows while the first download runs.
+		USAL_LeaderboardSnapshotSubsystem* Snapshots = GetGameInstance()->GetSubsystem<USAL_LeaderboardSnapshotSubsystem>();
+		if (Snapshots && Snapshots->LoadEntries(Key, EntriesData))
+		{
+			FCachedQuery& Seeded = Cache.Add(Key);
+			Seeded.Data        = EntriesData;
+			Seeded.LastReadAt  = Now;
+			Seeded.ContentHash = EntriesData.Store->ComputeContentHash();
+			Seeded.Bytes       = EntriesData.Store->GetAllocatedSize();
+			TotalBytes += Seeded.Bytes;
+
+			Refresh(Key);
+			EnforceBudget();
+			return true;
+		}
+
+		Refresh(Key);
+		return false;
+	}
+
+	++NumHits;
+	Cached->LastReadAt = Now;
+	EntriesData = Cached->Data;
+	bIsStale = (Now - Cached->FetchedAt) > GetTTL(Key.Handle);
+
+	if (bIsStale)
+	{
+		Refresh(Key);
+	}
+
+	return true;
+}
+
+void USAL_LeaderboardCacheSubsystem::SetBoardTTL(FSAL_LeaderboardHandle LeaderboardHandle, float TTLSeconds)
+{
+	if (TTLSeconds <= 0.0f)
+	{
+		BoardTTLs.Remove(LeaderboardHandle.Value);
+		return;
+	}
+
+	BoardTTLs.Add(LeaderboardHandle.Value, TTLSeconds);
+}
+
+void USAL_LeaderboardCacheSubsystem::InvalidateBoard(FSAL_LeaderboardHandle LeaderboardHandle)
+{
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Handle == LeaderboardHandle.Value)
+		{
+			TotalBytes -= It.Value().Bytes;
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = RankIndexes.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Key == LeaderboardHandle.Value)
+		{
+			TotalBytes -= It.Value()->GetAllocatedSize();
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = RetryAfter.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Handle == LeaderboardHandle.Value)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void USAL_LeaderboardCacheSubsystem::ClearCache()
+{
+	Cache.Empty();
+	RankIndexes.Empty();
+	RetryAfter.Empty();
+	TotalBytes = 0;
+}
+
+void USAL_LeaderboardCacheSubsystem::GetCacheStats(int32& NumQueries, int64& UsedBytes, int32& Hits, int32& Misses,
+                                                   int32& Refreshes) const
+{
+	NumQueries   = Cache.Num();
+	UsedBytes    = static_cast<int64>(TotalBytes);
+	Hits         = NumHits;
+	Misses       = NumMisses;
+	Refreshes    = NumRefreshes;
+}
+
+void USAL_LeaderboardCacheSubsystem::RequestGlobalRange(FSAL_LeaderboardHandle LeaderboardHandle, int32 RangeStart,
+                                                        int32 RangeEnd, int32 DetailsMax,
+                                                        FSAL_LeaderboardDownloadCoalescer::FOnComplete OnComplete,
+                                                        int32* OutNumDownloads)
+{
+	check(IsInGameThread());
+
+	const TPair<int64, int32> IndexKey(LeaderboardHandle.Value, FMath::Clamp(DetailsMax, 0, 64));
+	TSharedPtr<FSAL_RankRangeIndex>& Index = RankIndexes.FindOrAdd(IndexKey);
+	if (!Index.IsValid())
+	{
+		Index = MakeShared<FSAL_RankRangeIndex>();
+	}
+
+	const float TTL = GetTTL(LeaderboardHandle.Value);
+	const SIZE_T OldBytes = Index->GetAllocatedSize();
+	Index->Prune(TTL);
+	UpdateIndexBytes(*Index, OldBytes);
+
+	TArray<FInt32Interval> Gaps;
+	Index->GetMissing(RangeStart, RangeEnd, TTL, Gaps);
+
+	if (OutNumDownloads)
+	{
+		*OutNumDownloads = Gaps.Num();
+	}
+
+	if (Gaps.Num() == 0)
+	{
+		++NumHits;
+		FinishGlobalRange(IndexKey, RangeStart, RangeEnd, OnComplete);
+		return;
+	}
+
+	++NumMisses;
+
+	struct FRangeRequest
+	{
+		int32 NumPending = 0;
+		FString Error;
+		FSAL_LeaderboardDownloadCoalescer::FOnComplete OnComplete;
+	};
+
+	TSharedPtr<FRangeRequest> Request = MakeShared<FRangeRequest>();
+	Request->NumPending = Gaps.Num();
+	Request->OnComplete = MoveTemp(OnComplete);
+
+	TWeakObjectPtr<USAL_LeaderboardCacheSubsystem> Self(this);
+
+	for (const FInt32Interval& Gap : Gaps)
+	{
+		const FSAL_LeaderboardQueryKey Key(LeaderboardHandle, ELeaderboardRequestType::Global, Gap.Min, Gap.Max, IndexKey.Value);
+		FString Error;
+
+		const bool bRequested = FSAL_LeaderboardDownloadCoalescer::Get().Request(Key,
+			[Self, Request, IndexKey, Gap, RangeStart, RangeEnd](bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Why)
+			{
+				if (!Self.IsValid()) return;
+
+				if (!bOk)
+				{
+					Request->Error = Why;
+				}
+				else if (EntriesData.Store.IsValid())
+				{
+					if (const TSharedPtr<FSAL_RankRangeIndex>* Found = Self->RankIndexes.Find(IndexKey))
+					{
+						const SIZE_T OldBytes = (*Found)->GetAllocatedSize();
+						(*Found)->Insert(Gap.Min, Gap.Max, *EntriesData.Store);
+						Self->UpdateIndexBytes(**Found, OldBytes);
+					}
+				}
+
+				if (--Request->NumPending > 0)
+				{
+					return;
+				}
+
+				if (!Request->Error.IsEmpty())
+				{
+					Self->EnforceBudget();
+
+					FSAL_LeaderboardEntriesData Empty;
+					Request->OnComplete(false, Empty, Request->Error);
+					return;
+				}
+
+				Self->FinishGlobalRange(IndexKey, RangeStart, RangeEnd, Request->OnComplete);
+			},
+			Error,
+			RefreshConversionBudgetMicroseconds);
+
+		if (!bRequested)
+		{
+			// Gaps that never started still count as answered, so the request finishes once the rest return.
+			Request->Error = Error;
+
+			if (--Request->NumPending == 0)
+			{
+				FSAL_LeaderboardEntriesData Empty;
+				Request->OnComplete(false, Empty, Request->Error);
+			}
+		}
+	}
+}
+
+void USAL_LeaderboardCacheSubsystem::FinishGlobalRange(const TPair<int64, int32>& IndexKey, int32 RangeStart,
+                                                       int32 RangeEnd,
+                                                       const FSAL_LeaderboardDownloadCoalescer::FOnComplete& OnComplete)
+{
+	FSAL_LeaderboardEntriesData EntriesData;
+	EntriesData.RequestType = ELeaderboardRequestType::Global;
+	EntriesData.Store = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+
+	if (const TSharedPtr<FSAL_RankRangeIndex>* Index = RankIndexes.Find(IndexKey))
+	{
+		(*Index)->Assemble(RangeStart, RangeEnd, *EntriesData.Store);
+	}
+
+	EntriesData.TotalEntryCount = EntriesData.Store->Num();
+
+	// Segments of this range were just read, so the budget evicts other ranges first.
+	EnforceBudget();
+
+	OnComplete(true, EntriesData, FString());
+}
+
+void USAL_LeaderboardCacheSubsystem::ForEachCached(int64 Handle,
+	TFunctionRef<void(const FSAL_LeaderboardQueryKey&, const FSAL_LeaderboardEntriesData&)> Visitor) const
+{
+	for (const TPair<FSAL_LeaderboardQueryKey, FCachedQuery>& Pair : Cache)
+	{
+		if (Handle == 0 || Pair.Key.Handle == Handle)
+		{
+			Visitor(Pair.Key, Pair.Value.Data);
+		}
+	}
+}
+
+float USAL_LeaderboardCacheSubsystem::GetTTL(int64 Handle) const
+{
+	const float* TTL = BoardTTLs.Find(Handle);
+	return TTL ? *TTL : DefaultTTLSeconds;
+}
+
+void USAL_LeaderboardCacheSubsystem::Refresh(const FSAL_LeaderboardQueryKey& Key)
+{
+	FCachedQuery* Cached = Cache.Find(Key);
+	if (Cached ? Cached->bRefreshing : ColdRefreshes.Contains(Key))
+	{
+		return;
+	}
+
+	// Back off after a failure instead of asking Steam again on every read.
+	if (const double* RetryAt = RetryAfter.Find(Key))
+	{
+		if (FPlatformTime::Seconds() < *RetryAt)
+		{
+			return;
+		}
+	}
+
+	TWeakObjectPtr<USAL_LeaderboardCacheSubsystem> Self(this);
+	FString Error;
+
+	const bool bRequested = FSAL_LeaderboardDownloadCoalescer::Get().Request(Key,
+		[Self, Key](bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Why)
+		{
+			if (!Self.IsValid()) return;
+			Self->OnRefreshed(Key, bOk, EntriesData, Why);
+		},
+		Error,
+		RefreshConversionBudgetMicroseconds);
+
+	if (!bRequested)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardCache: refresh failed to start (Handle=%lld): %s"), Key.Handle, *Error);
+		OnRefreshFailedInternal(Key, Error);
+		return;
+	}
+
+	++NumRefreshes;
+
+	if (Cached)
+	{
+		Cached->bRefreshing = true;
+	}
+	else
+	{
+		ColdRefreshes.Add(Key);
+	}
+}
+
+void USAL_LeaderboardCacheSubsystem::OnRefreshed(const FSAL_LeaderboardQueryKey& Key, bool bOk,
+                                                 const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error)
+{
+	ColdRefreshes.Remove(Key);
+
+	if (!bOk)
+	{
+		if (FCachedQuery* Cached = Cache.Find(Key))
+		{
+			Cached->bRefreshing = false;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardCache: refresh failed (Handle=%lld): %s"), Key.Handle, *Error);
+		OnRefreshFailedInternal(Key, Error);
+		return;
+	}
+
+	RetryAfter.Remove(Key);
+
+	if (USAL_LeaderboardSnapshotSubsystem* Snapshots = GetGameInstance()->GetSubsystem<USAL_LeaderboardSnapshotSubsystem>())
+	{
+		Snapshots->AutoSnapshot(Key, EntriesData);
+	}
+
+	Put(Key, EntriesData);
+}
+
+void USAL_LeaderboardCacheSubsystem::OnRefreshFailedInternal(const FSAL_LeaderboardQueryKey& Key, const FString& Error)
+{
+	RetryAfter.Add(Key, FPlatformTime::Seconds() + FMath::Max(RefreshRetrySeconds, 0.0f));
+
+	FSAL_LeaderboardHandle Handle;
+	Handle.Value = Key.Handle;
+
+	OnRefreshFailed.Broadcast(Handle, Key.RequestType, Key.RangeStart, Key.RangeEnd, Error);
+}
+
+void USAL_LeaderboardCacheSubsystem::Put(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	const double Now = FPlatformTime::Seconds();
+	const uint32 NewHash = EntriesData.Store.IsValid() ? EntriesData.Store->ComputeContentHash() : 0;
+	const SIZE_T NewBytes = EntriesData.Store.IsValid() ? EntriesData.Store->GetAllocatedSize() : 0;
+
+	FCachedQuery* Cached = Cache.Find(Key);
+	const bool bChanged = (Cached == nullptr) || (Cached->ContentHash != NewHash) || (Cached->Data.Num() != EntriesData.Num());
+
+	if (Cached == nullptr)
+	{
+		Cached = &Cache.Add(Key);
+		Cached->LastReadAt = Now;
+	}
+
+	Cached->FetchedAt = Now;
+	Cached->bRefreshing = false;
+
+	if (bChanged)
+	{
+		TotalBytes -= Cached->Bytes;
+		TotalBytes += NewBytes;
+
+		Cached->Data = EntriesData;
+		Cached->ContentHash = NewHash;
+		Cached->Bytes = NewBytes;
+	}
+
+	EnforceBudget();
+
+	if (bChanged)
+	{
+		if (USAL_PersonaResolverSubsystem* Resolver = GetGameInstance()->GetSubsystem<USAL_PersonaResolverSubsystem>())
+		{
+			Resolver->Track(EntriesData);
+		}
+
+		FSAL_LeaderboardHandle Handle;
+		Handle.Value = Key.Handle;
+
+		OnEntriesUpdated.Broadcast(Handle, Key.RequestType, Key.RangeStart, Key.RangeEnd, EntriesData);
+	}
+}
+
+void USAL_LeaderboardCacheSubsystem::UpdateIndexBytes(FSAL_RankRangeIndex& Index, SIZE_T OldBytes)
+{
+	TotalBytes -= OldBytes;
+	TotalBytes += Index.GetAllocatedSize();
+}
+
+void USAL_LeaderboardCacheSubsystem::EnforceBudget()
+{
+	while (TotalBytes > static_cast<SIZE_T>(FMath::Max<int64>(MemoryBudgetBytes, 0)))
+	{
+		// Queries and rank-range segments share one least-recently-read order.
+		const FSAL_LeaderboardQueryKey* OldestKey = nullptr;
+		double OldestRead = TNumericLimits<double>::Max();
+
+		if (Cache.Num() > 1)
+		{
+			for (const TPair<FSAL_LeaderboardQueryKey, FCachedQuery>& Pair : Cache)
+			{
+				if (!Pair.Value.bRefreshing && Pair.Value.LastReadAt < OldestRead)
+				{
+					OldestRead = Pair.Value.LastReadAt;
+					OldestKey = &Pair.Key;
+				}
+			}
+		}
+
+		FSAL_RankRangeIndex* OldestIndex = nullptr;
+
+		for (const TPair<TPair<int64, int32>, TSharedPtr<FSAL_RankRangeIndex>>& Pair : RankIndexes)
+		{
+			double SegmentRead = 0.0;
+			if (Pair.Value->GetOldestRead(SegmentRead) && SegmentRead < OldestRead)
+			{
+				OldestRead = SegmentRead;
+				OldestIndex = Pair.Value.Get();
+			}
+		}
+
+		if (OldestIndex != nullptr)
+		{
+			const SIZE_T OldBytes = OldestIndex->GetAllocatedSize();
+			OldestIndex->EvictOldest();
+			UpdateIndexBytes(*OldestIndex, OldBytes);
+			continue;
+		}
+
+		if (OldestKey == nullptr)
+		{
+			return;
+		}
+
+		const FSAL_LeaderboardQueryKey KeyToEvict = *OldestKey;
+		TotalBytes -= Cache.FindChecked(KeyToEvict).Bytes;
+		Cache.Remove(KeyToEvict);
+	}
+}
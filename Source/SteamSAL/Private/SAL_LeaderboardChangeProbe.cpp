@@ -0,0 +1,194 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardChangeProbe.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SteamSALBlueprintLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "UObject/ObjectKey.h"
+
+FSAL_LeaderboardChangeProbe& FSAL_LeaderboardChangeProbe::Get(const UObject* WorldContextObject)
+{
+	check(IsInGameThread());
+
+	static TMap<TObjectKey<UGameInstance>, TSharedRef<FSAL_LeaderboardChangeProbe>> Probes;
+
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const TObjectKey<UGameInstance> GameInstanceKey(World ? World->GetGameInstance() : nullptr);
+
+	// Drop the probes of GameInstances that shut down (ended PIE sessions); callers without one share the null key.
+	for (auto It = Probes.CreateIterator(); It; ++It)
+	{
+		if (It.Key() != TObjectKey<UGameInstance>() && It.Key().ResolveObjectPtr() == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (const TSharedRef<FSAL_LeaderboardChangeProbe>* Existing = Probes.Find(GameInstanceKey))
+	{
+		return Existing->Get();
+	}
+
+	return Probes.Add(GameInstanceKey, MakeShared<FSAL_LeaderboardChangeProbe>()).Get();
+}
+
+void FSAL_LeaderboardChangeProbe::Remember(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	check(IsInGameThread());
+
+	if (Key.RequestType == ELeaderboardRequestType::Friends || EntriesData.Num() == 0)
+	{
+		Remembered.Remove(Key);
+		return;
+	}
+
+	FSAL_LeaderboardHandle Handle;
+	Handle.Value = Key.Handle;
+
+	const int32 Last = EntriesData.Num() - 1;
+
+	if (!Remembered.Contains(Key) && Remembered.Num() >= MaxRemembered)
+	{
+		const FSAL_LeaderboardQueryKey* OldestKey = nullptr;
+		double OldestUse = TNumericLimits<double>::Max();
+
+		for (const TPair<FSAL_LeaderboardQueryKey, FRemembered>& Pair : Remembered)
+		{
+			if (Pair.Value.LastUsedAt < OldestUse)
+			{
+				OldestUse = Pair.Value.LastUsedAt;
+				OldestKey = &Pair.Key;
+			}
+		}
+
+		const FSAL_LeaderboardQueryKey KeyToEvict = *OldestKey;
+		Remembered.Remove(KeyToEvict);
+	}
+
+	FRemembered& Entry = Remembered.FindOrAdd(Key);
+	Entry.Data = EntriesData;
+	Entry.LastUsedAt = FPlatformTime::Seconds();
+	Entry.Fingerprint.EntryCount = USteamSALBlueprintLibrary::GetLeaderboardEntryCount(Handle);
+	Entry.Fingerprint.FirstSteamID = EntriesData.GetSteamID64(0);
+	Entry.Fingerprint.FirstRank = EntriesData.GetGlobalRank(0);
+	Entry.Fingerprint.FirstScore = EntriesData.GetScore(0);
+	Entry.Fingerprint.LastSteamID = EntriesData.GetSteamID64(Last);
+	Entry.Fingerprint.LastRank = EntriesData.GetGlobalRank(Last);
+	Entry.Fingerprint.LastScore = EntriesData.GetScore(Last);
+}
+
+void FSAL_LeaderboardChangeProbe::Forget(int64 Handle)
+{
+	for (auto It = Remembered.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Handle == Handle)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FSAL_LeaderboardChangeProbe::Probe(const FSAL_LeaderboardQueryKey& Key, FOnProbed OnProbed)
+{
+	check(IsInGameThread());
+
+	FRemembered* Entry = Remembered.Find(Key);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+
+	Entry->LastUsedAt = FPlatformTime::Seconds();
+
+	FSAL_LeaderboardHandle Handle;
+	Handle.Value = Key.Handle;
+
+	++NumProbes;
+
+	const FFingerprint Fingerprint = Entry->Fingerprint;
+	const FSAL_LeaderboardEntriesData Data = Entry->Data;
+
+	struct FProbeState
+	{
+		int32 Pending = 0;
+		int32 EntryCount = 0;
+		bool bUnchanged = true;
+		FOnProbed OnProbed;
+	};
+
+	TSharedRef<FProbeState> State = MakeShared<FProbeState>();
+	State->OnProbed = MoveTemp(OnProbed);
+
+	TArray<TTuple<int32, uint64, int32>, TInlineAllocator<2>> Checks;
+	Checks.Emplace(Fingerprint.FirstRank, Fingerprint.FirstSteamID, Fingerprint.FirstScore);
+	if (Fingerprint.LastRank != Fingerprint.FirstRank)
+	{
+		Checks.Emplace(Fingerprint.LastRank, Fingerprint.LastSteamID, Fingerprint.LastScore);
+	}
+
+	State->Pending = Checks.Num();
+
+	TWeakPtr<FSAL_LeaderboardChangeProbe> WeakThis = AsShared();
+
+	auto Finish = [WeakThis, State, Data, Fingerprint]()
+	{
+		if (--State->Pending > 0)
+		{
+			return;
+		}
+
+		// Rows inserted inside the range leave both ends alone but always move the board's count.
+		if (State->EntryCount != Fingerprint.EntryCount)
+		{
+			State->bUnchanged = false;
+		}
+
+		const TSharedPtr<FSAL_LeaderboardChangeProbe> This = WeakThis.Pin();
+		if (State->bUnchanged && This.IsValid())
+		{
+			++This->NumSkipped;
+		}
+
+		State->OnProbed(State->bUnchanged, Data);
+	};
+
+	for (const TTuple<int32, uint64, int32>& Check : Checks)
+	{
+		const int32 Rank = Check.Get<0>();
+		const uint64 SteamID = Check.Get<1>();
+		const int32 Score = Check.Get<2>();
+
+		FString Error;
+		const bool bRequested = FSAL_LeaderboardDownloadCoalescer::Get().Request(
+			FSAL_LeaderboardQueryKey(Handle, ELeaderboardRequestType::Global, Rank, Rank, 0),
+			[State, Finish, Handle, SteamID, Score](bool bOk, const FSAL_LeaderboardEntriesData& Row, const FString&)
+			{
+				// Steam refreshes the entry count only when a download lands, so read it here, not before the probe.
+				if (bOk)
+				{
+					State->EntryCount = USteamSALBlueprintLibrary::GetLeaderboardEntryCount(Handle);
+				}
+
+				// A failed probe cannot prove anything, so it counts as changed.
+				if (!bOk || Row.Num() != 1 || Row.GetSteamID64(0) != SteamID || Row.GetScore(0) != Score)
+				{
+					State->bUnchanged = false;
+				}
+
+				Finish();
+			},
+			Error);
+
+		if (!bRequested)
+		{
+			State->bUnchanged = false;
+			Finish();
+		}
+	}
+
+	return true;
+}
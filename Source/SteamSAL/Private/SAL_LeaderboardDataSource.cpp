@@ -0,0 +1,233 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardDataSource.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_PersonaResolverSubsystem.h"
+#include "SteamSALBlueprintLibrary.h"
+#include "UObject/Package.h"
+
+USAL_LeaderboardDataSource* USAL_LeaderboardDataSource::CreateLeaderboardDataSource(
+	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle, int32 PageSize, int64 MemoryBudgetBytes,
+	int32 DetailsMax)
+{
+	USAL_LeaderboardDataSource* Source = NewObject<USAL_LeaderboardDataSource>(
+		WorldContextObject ? WorldContextObject : static_cast<UObject*>(GetTransientPackage()));
+
+	Source->Handle = LeaderboardHandle;
+	Source->PageSize = FMath::Max(PageSize, 1);
+	Source->MemoryBudgetBytes = FMath::Max<int64>(MemoryBudgetBytes, 0);
+	Source->DetailsMax = FMath::Clamp(DetailsMax, 0, 64);
+	Source->TotalCount = USteamSALBlueprintLibrary::GetLeaderboardEntryCount(LeaderboardHandle);
+
+	if (LeaderboardHandle.Value == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardDataSource: Invalid LeaderboardHandle"));
+	}
+
+	return Source;
+}
+
+void USAL_LeaderboardDataSource::Refresh()
+{
+	++Generation;
+
+	Pages.Empty();
+	PendingPages.Empty();
+	PageRetryAt.Empty();
+	NextFailureBroadcastAt = 0.0;
+	TotalBytes = 0;
+
+	TotalCount = USteamSALBlueprintLibrary::GetLeaderboardEntryCount(Handle);
+
+	for (int32 PageIndex = VisibleFirstPage; PageIndex <= VisibleLastPage; ++PageIndex)
+	{
+		RequestPage(PageIndex);
+	}
+}
+
+bool USAL_LeaderboardDataSource::GetRow(int32 Index, FSAL_LeaderboardEntryRow& Row)
+{
+	Row = FSAL_LeaderboardEntryRow();
+
+	if (Index < 0 || Index >= TotalCount)
+	{
+		return false;
+	}
+
+	const int32 PageIndex = Index / PageSize;
+
+	FPage* Page = Pages.Find(PageIndex);
+	if (Page == nullptr)
+	{
+		RequestPage(PageIndex);
+		return false;
+	}
+
+	Page->LastUsedAt = FPlatformTime::Seconds();
+
+	// A page may hold fewer rows than PageSize if the board shrank since TotalCount was read.
+	return Page->Data.GetRow(Index - PageIndex * PageSize, Row);
+}
+
+void USAL_LeaderboardDataSource::SetVisibleRange(int32 FirstIndex, int32 LastIndex)
+{
+	if (TotalCount <= 0 || LastIndex < FirstIndex)
+	{
+		return;
+	}
+
+	FirstIndex = FMath::Clamp(FirstIndex, 0, TotalCount - 1);
+	LastIndex = FMath::Clamp(LastIndex, 0, TotalCount - 1);
+
+	const int32 Direction = (FirstIndex > LastVisibleFirstIndex) ? 1 : (FirstIndex < LastVisibleFirstIndex ? -1 : 0);
+	LastVisibleFirstIndex = FirstIndex;
+
+	VisibleFirstPage = FirstIndex / PageSize;
+	VisibleLastPage = LastIndex / PageSize;
+
+	const double Now = FPlatformTime::Seconds();
+
+	for (int32 PageIndex = VisibleFirstPage; PageIndex <= VisibleLastPage; ++PageIndex)
+	{
+		if (FPage* Page = Pages.Find(PageIndex))
+		{
+			Page->LastUsedAt = Now;
+		}
+		else
+		{
+			RequestPage(PageIndex);
+		}
+	}
+
+	const int32 PrefetchPage = (Direction < 0) ? VisibleFirstPage - 1 : VisibleLastPage + 1;
+	if (PrefetchPage >= 0 && PrefetchPage < GetNumPages() && !Pages.Contains(PrefetchPage))
+	{
+		RequestPage(PrefetchPage);
+	}
+}
+
+void USAL_LeaderboardDataSource::RequestPage(int32 PageIndex)
+{
+	if (Handle.Value == 0 || PageIndex < 0 || PageIndex >= GetNumPages() || PendingPages.Contains(PageIndex))
+	{
+		return;
+	}
+
+	if (const double* RetryAt = PageRetryAt.Find(PageIndex))
+	{
+		if (FPlatformTime::Seconds() < *RetryAt)
+		{
+			return;
+		}
+	}
+
+	const int32 Start = PageIndex * PageSize + 1;
+	const int32 End = Start + PageSize - 1;
+	const FSAL_LeaderboardQueryKey Key(Handle, ELeaderboardRequestType::Global, Start, End, DetailsMax);
+
+	TWeakObjectPtr<USAL_LeaderboardDataSource> Self(this);
+	const int32 RequestGeneration = Generation;
+	FString Error;
+
+	const bool bRequested = FSAL_LeaderboardDownloadCoalescer::Get().Request(Key,
+		[Self, PageIndex, RequestGeneration](bool bOk, const FSAL_LeaderboardEntriesData& PageData, const FString& Why)
+		{
+			if (!Self.IsValid()) return;
+			Self->OnPageLoaded(PageIndex, RequestGeneration, bOk, PageData, Why);
+		},
+		Error);
+
+	if (!bRequested)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardDataSource: page %d failed to start: %s"), PageIndex, *Error);
+		OnPageFailed(PageIndex, Error);
+		return;
+	}
+
+	PendingPages.Add(PageIndex);
+}
+
+void USAL_LeaderboardDataSource::OnPageLoaded(int32 PageIndex, int32 RequestGeneration, bool bOk,
+                                              const FSAL_LeaderboardEntriesData& PageData, const FString& Error)
+{
+	if (RequestGeneration != Generation)
+	{
+		return;
+	}
+
+	PendingPages.Remove(PageIndex);
+
+	if (!bOk)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardDataSource: page %d failed: %s"), PageIndex, *Error);
+		OnPageFailed(PageIndex, Error);
+		return;
+	}
+
+	PageRetryAt.Remove(PageIndex);
+
+	FPage& Page = Pages.FindOrAdd(PageIndex);
+	TotalBytes -= Page.Bytes;
+
+	Page.Data = PageData;
+	Page.LastUsedAt = FPlatformTime::Seconds();
+	Page.Bytes = PageData.Store.IsValid() ? PageData.Store->GetAllocatedSize() : 0;
+	TotalBytes += Page.Bytes;
+
+	if (USAL_PersonaResolverSubsystem* Resolver = USAL_PersonaResolverSubsystem::Get(GetOuter()))
+	{
+		Resolver->Track(PageData);
+	}
+
+	EnforceBudget();
+
+	OnRowsLoaded.Broadcast(PageIndex * PageSize, PageData.Num());
+}
+
+void USAL_LeaderboardDataSource::OnPageFailed(int32 PageIndex, const FString& Error)
+{
+	const double Now = FPlatformTime::Seconds();
+	const double RetryDelay = FMath::Max(FailureRetrySeconds, 0.0f);
+
+	PageRetryAt.Add(PageIndex, Now + RetryDelay);
+
+	// Several visible pages usually fail together; report the outage once per retry window.
+	if (Now >= NextFailureBroadcastAt)
+	{
+		NextFailureBroadcastAt = Now + RetryDelay;
+		OnFailure.Broadcast(Error);
+	}
+}
+
+void USAL_LeaderboardDataSource::EnforceBudget()
+{
+	while (TotalBytes > static_cast<SIZE_T>(MemoryBudgetBytes))
+	{
+		int32 OldestPage = INDEX_NONE;
+		double OldestUse = TNumericLimits<double>::Max();
+
+		for (const TPair<int32, FPage>& Pair : Pages)
+		{
+			const bool bVisible = Pair.Key >= VisibleFirstPage && Pair.Key <= VisibleLastPage;
+			if (!bVisible && Pair.Value.LastUsedAt < OldestUse)
+			{
+				OldestUse = Pair.Value.LastUsedAt;
+				OldestPage = Pair.Key;
+			}
+		}
+
+		if (OldestPage == INDEX_NONE)
+		{
+			return;
+		}
+
+		TotalBytes -= Pages.FindChecked(OldestPage).Bytes;
+		Pages.Remove(OldestPage);
+	}
+}
+
+int32 USAL_LeaderboardDataSource::GetNumPages() const
+{
+	return (TotalCount + PageSize - 1) / PageSize;
+}
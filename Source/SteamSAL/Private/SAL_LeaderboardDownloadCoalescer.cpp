@@ -0,0 +1,224 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_Internal.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "Containers/Ticker.h"
+
+FSAL_LeaderboardQueryKey::FSAL_LeaderboardQueryKey(const FSAL_LeaderboardHandle& InHandle,
+                                                   ELeaderboardRequestType InRequestType,
+                                                   int32 InRangeStart, int32 InRangeEnd, int32 InDetailsMax)
+	: Handle(InHandle.Value)
+	, RequestType(InRequestType)
+	, RangeStart(InRequestType == ELeaderboardRequestType::Friends ? 0 : InRangeStart)
+	, RangeEnd(InRequestType == ELeaderboardRequestType::Friends ? 0 : InRangeEnd)
+	, DetailsMax(FMath::Clamp(InDetailsMax, 0, 64))
+{
+}
+
+FSAL_LeaderboardDownloadCoalescer& FSAL_LeaderboardDownloadCoalescer::Get()
+{
+	static FSAL_LeaderboardDownloadCoalescer Instance;
+	return Instance;
+}
+
+static void SAL_MergeConversionBudget(std::atomic<int32>& Current, int32 Requested)
+{
+	if (Requested <= 0)
+	{
+		return;
+	}
+
+	const int32 Existing = Current.load();
+	if (Existing <= 0 || Requested < Existing)
+	{
+		Current.store(Requested);
+	}
+}
+
+bool FSAL_LeaderboardDownloadCoalescer::Request(const FSAL_LeaderboardQueryKey& Key, FOnComplete OnComplete,
+                                                FString& OutError, int32 ConversionBudgetMicroseconds)
+{
+	check(IsInGameThread());
+
+	if (const TSharedPtr<FInFlightDownload>* Existing = InFlight.Find(Key))
+	{
+		(*Existing)->Waiters.Add(MoveTemp(OnComplete));
+		SAL_MergeConversionBudget((*Existing)->ConversionBudgetMicroseconds, ConversionBudgetMicroseconds);
+		++NumCoalesced;
+
+		UE_LOG(LogTemp, Verbose, TEXT("[SAL] DownloadCoalescer: attached to pending download (Handle=%lld, Range=[%d..%d], Waiters=%d)"),
+		       Key.Handle, Key.RangeStart, Key.RangeEnd, (*Existing)->Waiters.Num());
+		return true;
+	}
+
+	if (SteamUserStats() == nullptr)
+	{
+		OutError = TEXT("SteamUserStats not available or not initialized.");
+		return false;
+	}
+
+	ELeaderboardDataRequest DataRequest = k_ELeaderboardDataRequestGlobal;
+	switch (Key.RequestType)
+	{
+	case ELeaderboardRequestType::Global:
+		DataRequest = k_ELeaderboardDataRequestGlobal;
+		break;
+
+	case ELeaderboardRequestType::GlobalAroundUser:
+		DataRequest = k_ELeaderboardDataRequestGlobalAroundUser;
+		break;
+
+	case ELeaderboardRequestType::Friends:
+		DataRequest = k_ELeaderboardDataRequestFriends;
+		break;
+
+	default:
+		DataRequest = k_ELeaderboardDataRequestGlobal;
+		break;
+	}
+
+	SteamAPICall_t APICall = SteamUserStats()->DownloadLeaderboardEntries(
+		static_cast<SteamLeaderboard_t>(Key.Handle),
+		DataRequest,
+		Key.RangeStart,
+		Key.RangeEnd
+	);
+
+	if (APICall == k_uAPICallInvalid)
+	{
+		OutError = TEXT("Steam returned an invalid API call handle.");
+		return false;
+	}
+
+	TSharedPtr<FInFlightDownload> Download = MakeShared<FInFlightDownload>();
+	Download->Waiters.Add(MoveTemp(OnComplete));
+	SAL_MergeConversionBudget(Download->ConversionBudgetMicroseconds, ConversionBudgetMicroseconds);
+	InFlight.Add(Key, Download);
+
+	// The download stays in InFlight until Complete() runs on the GameThread, which is always after this handler.
+	FInFlightDownload* DownloadPtr = Download.Get();
+
+	Download->Call.Set(APICall, [Key, DownloadPtr](LeaderboardScoresDownloaded_t* Callback, bool bIOFailure)
+	{
+		FSAL_LeaderboardEntriesData EntriesData;
+		EntriesData.RequestType = Key.RequestType;
+
+		if (bIOFailure || Callback == nullptr)
+		{
+			SAL_RunOnGameThread([Key, EntriesData]()
+			{
+				Get().Complete(Key, false, EntriesData, TEXT("Steam leaderboard download failed (IO failure)."));
+			});
+			return;
+		}
+
+		if (SteamUserStats() == nullptr)
+		{
+			SAL_RunOnGameThread([Key, EntriesData]()
+			{
+				Get().Complete(Key, false, EntriesData, TEXT("SteamUserStats not available in callback."));
+			});
+			return;
+		}
+
+		const int32 BudgetMicroseconds = DownloadPtr->ConversionBudgetMicroseconds.load();
+		if (BudgetMicroseconds > 0 && Callback->m_cEntryCount > 0)
+		{
+			const SteamLeaderboardEntries_t EntriesHandle = Callback->m_hSteamLeaderboardEntries;
+			const int32 EntryCount = Callback->m_cEntryCount;
+
+			SAL_RunOnGameThread([Key, EntriesHandle, EntryCount, BudgetMicroseconds]()
+			{
+				Get().StartSlicedConversion(Key, EntriesHandle, EntryCount, BudgetMicroseconds);
+			});
+			return;
+		}
+
+		EntriesData.TotalEntryCount = Callback->m_cEntryCount;
+		EntriesData.Store = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+
+		if (Callback->m_cEntryCount > 0)
+		{
+			EntriesData.Store->ReserveForDownload(Callback->m_cEntryCount, Key.DetailsMax);
+			EntriesData.Store->AppendFromSteam(
+				Callback->m_hSteamLeaderboardEntries,
+				0,
+				Callback->m_cEntryCount,
+				Key.DetailsMax
+			);
+		}
+
+		SAL_RunOnGameThread([Key, EntriesData = MoveTemp(EntriesData)]()
+		{
+			Get().Complete(Key, true, EntriesData, FString());
+		});
+	});
+
+	return true;
+}
+
+void FSAL_LeaderboardDownloadCoalescer::Complete(const FSAL_LeaderboardQueryKey& Key, bool bOk,
+                                                 const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error)
+{
+	TSharedPtr<FInFlightDownload> Download;
+	if (!InFlight.RemoveAndCopyValue(Key, Download) || !Download.IsValid())
+	{
+		return;
+	}
+
+	if (bOk)
+	{
+		OnDownloaded.Broadcast(Key, EntriesData);
+	}
+
+	for (const FOnComplete& Waiter : Download->Waiters)
+	{
+		if (Waiter)
+		{
+			Waiter(bOk, EntriesData, Error);
+		}
+	}
+}
+
+void FSAL_LeaderboardDownloadCoalescer::StartSlicedConversion(const FSAL_LeaderboardQueryKey& Key,
+                                                              SteamLeaderboardEntries_t EntriesHandle,
+                                                              int32 EntryCount, int32 BudgetMicroseconds)
+{
+	FSAL_LeaderboardEntriesData EntriesData;
+	EntriesData.RequestType = Key.RequestType;
+	EntriesData.TotalEntryCount = EntryCount;
+	EntriesData.Store = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+	EntriesData.Store->ReserveForDownload(EntryCount, Key.DetailsMax);
+
+	const double BudgetSeconds = BudgetMicroseconds / 1000000.0;
+	int32 NextIndex = 0;
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[Key, EntriesHandle, EntryCount, BudgetSeconds, NextIndex, EntriesData](float) mutable
+		{
+			if (SteamUserStats() == nullptr)
+			{
+				Get().Complete(Key, false, EntriesData, TEXT("SteamUserStats not available during conversion."));
+				return false;
+			}
+
+			const double SliceStart = FPlatformTime::Seconds();
+
+			// Always convert at least one row per tick so a tiny budget still makes progress.
+			do
+			{
+				EntriesData.Store->AppendFromSteam(EntriesHandle, NextIndex, 1, Key.DetailsMax);
+				++NextIndex;
+			}
+			while (NextIndex < EntryCount && (FPlatformTime::Seconds() - SliceStart) < BudgetSeconds);
+
+			if (NextIndex < EntryCount)
+			{
+				return true;
+			}
+
+			Get().Complete(Key, true, EntriesData, FString());
+			return false;
+		}));
+}
@@ -0,0 +1,235 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardEntryStore.h"
+#include "Algo/StableSort.h"
+#include "Misc/Crc.h"
+
+FSAL_LeaderboardEntryStore::FSAL_LeaderboardEntryStore()
+{
+	DetailsOffsets.Add(0);
+}
+
+void FSAL_LeaderboardEntryStore::Reserve(int32 NumRows, int32 NumDetails, int32 NumNameChars)
+{
+	SteamIDs.Reserve(NumRows);
+	GlobalRanks.Reserve(NumRows);
+	Scores.Reserve(NumRows);
+	UGCHandles.Reserve(NumRows);
+	DetailsOffsets.Reserve(NumRows + 1);
+	NameOffsets.Reserve(NumRows);
+	NameLengths.Reserve(NumRows);
+
+	if (NumDetails > 0)
+	{
+		DetailsPool.Reserve(NumDetails);
+	}
+
+	if (NumNameChars > 0)
+	{
+		NameTable.Reserve(NumNameChars);
+	}
+}
+
+void FSAL_LeaderboardEntryStore::ReserveForDownload(int32 NumRows, int32 DetailsMax)
+{
+	// Boards rarely use more than a handful of details; rows beyond this estimate simply grow the pool.
+	constexpr int32 kReservedDetailsPerRow = 8;
+	constexpr int32 kReservedNameCharsPerRow = 16;
+
+	const int32 DetailsPerRow = FMath::Min(FMath::Clamp(DetailsMax, 0, 64), kReservedDetailsPerRow);
+
+	Reserve(Num() + NumRows,
+	        DetailsPool.Num() + NumRows * DetailsPerRow,
+	        NameTable.Num() + NumRows * kReservedNameCharsPerRow);
+}
+
+void FSAL_LeaderboardEntryStore::Reset()
+{
+	SteamIDs.Reset();
+	GlobalRanks.Reset();
+	Scores.Reset();
+	UGCHandles.Reset();
+	DetailsOffsets.Reset();
+	DetailsOffsets.Add(0);
+	DetailsPool.Reset();
+	NameOffsets.Reset();
+	NameLengths.Reset();
+	NameTable.Reset();
+}
+
+int32 FSAL_LeaderboardEntryStore::AddRow(uint64 SteamID, int32 GlobalRank, int32 Score, uint64 UGCHandle,
+                                         const int32* Details, int32 NumDetails, FStringView PlayerName)
+{
+	const int32 Index = SteamIDs.Add(SteamID);
+	GlobalRanks.Add(GlobalRank);
+	Scores.Add(Score);
+	UGCHandles.Add(UGCHandle);
+
+	if (Details != nullptr && NumDetails > 0)
+	{
+		DetailsPool.Append(Details, NumDetails);
+	}
+	DetailsOffsets.Add(DetailsPool.Num());
+
+	NameOffsets.Add(NameTable.Num());
+	NameLengths.Add(PlayerName.Len());
+	NameTable.Append(PlayerName.GetData(), PlayerName.Len());
+
+	return Index;
+}
+
+int32 FSAL_LeaderboardEntryStore::AppendFromSteam(SteamLeaderboardEntries_t EntriesHandle, int32 FirstIndex,
+                                                  int32 Count, int32 DetailsMax)
+{
+	if (SteamUserStats() == nullptr || Count <= 0)
+	{
+		return 0;
+	}
+
+	DetailsMax = FMath::Clamp(DetailsMax, 0, 64);
+
+	// Steam writes each row's details here before they are copied into the shared pool.
+	// With DetailsMax == 0 Steam is asked for no details at all.
+	int32 DetailBuffer[64];
+	int32* DetailsPtr = (DetailsMax > 0) ? DetailBuffer : nullptr;
+
+	int32 Added = 0;
+
+	for (int32 i = FirstIndex; i < FirstIndex + Count; ++i)
+	{
+		LeaderboardEntry_t Entry;
+
+		if (!SteamUserStats()->GetDownloadedLeaderboardEntry(EntriesHandle, i, &Entry, DetailsPtr, DetailsMax))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SteamSAL] Failed to get entry %d"), i);
+			continue;
+		}
+
+		const uint64 RawUGC = static_cast<uint64>(Entry.m_hUGC);
+		const uint64 UGC    = (RawUGC == k_UGCHandleInvalid) ? 0 : RawUGC;
+
+		// Missing names are left empty here; USAL_PersonaResolverSubsystem requests and patches them.
+		const char* Nick = SteamFriends() ? SteamFriends()->GetFriendPersonaName(Entry.m_steamIDUser) : nullptr;
+		const FUTF8ToTCHAR NickConv(Nick ? Nick : "");
+
+		AddRow(Entry.m_steamIDUser.ConvertToUint64(),
+		       Entry.m_nGlobalRank,
+		       Entry.m_nScore,
+		       UGC,
+		       DetailsPtr,
+		       FMath::Min(Entry.m_cDetails, DetailsMax),
+		       FStringView(NickConv.Get(), NickConv.Length()));
+
+		++Added;
+	}
+
+	return Added;
+}
+
+void FSAL_LeaderboardEntryStore::Append(const FSAL_LeaderboardEntryStore& Other)
+{
+	Reserve(Num() + Other.Num(), DetailsPool.Num() + Other.DetailsPool.Num(), NameTable.Num() + Other.NameTable.Num());
+
+	for (int32 i = 0; i < Other.Num(); ++i)
+	{
+		const TConstArrayView<int32> Details = Other.GetDetails(i);
+		AddRow(Other.SteamIDs[i], Other.GlobalRanks[i], Other.Scores[i], Other.UGCHandles[i],
+		       Details.GetData(), Details.Num(), Other.GetPlayerName(i));
+	}
+}
+
+void FSAL_LeaderboardEntryStore::SortByGlobalRank()
+{
+	TArray<int32> Order;
+	Order.Reserve(Num());
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		Order.Add(i);
+	}
+
+	Algo::StableSortBy(Order, [this](int32 Index) { return GlobalRanks[Index]; });
+
+	FSAL_LeaderboardEntryStore Sorted;
+	Sorted.Reserve(Num(), DetailsPool.Num(), NameTable.Num());
+
+	for (const int32 Index : Order)
+	{
+		const TConstArrayView<int32> Details = GetDetails(Index);
+		Sorted.AddRow(SteamIDs[Index], GlobalRanks[Index], Scores[Index], UGCHandles[Index],
+		              Details.GetData(), Details.Num(), GetPlayerName(Index));
+	}
+
+	*this = MoveTemp(Sorted);
+}
+
+TConstArrayView<int32> FSAL_LeaderboardEntryStore::GetDetails(int32 Index) const
+{
+	const int32 Begin = DetailsOffsets[Index];
+	const int32 End   = DetailsOffsets[Index + 1];
+	return TConstArrayView<int32>(DetailsPool.GetData() + Begin, End - Begin);
+}
+
+FStringView FSAL_LeaderboardEntryStore::GetPlayerName(int32 Index) const
+{
+	return FStringView(NameTable.GetData() + NameOffsets[Index], NameLengths[Index]);
+}
+
+void FSAL_LeaderboardEntryStore::SetPlayerName(int32 Index, FStringView PlayerName)
+{
+	if (!IsValidIndex(Index))
+	{
+		return;
+	}
+
+	NameOffsets[Index] = NameTable.Num();
+	NameLengths[Index] = PlayerName.Len();
+	NameTable.Append(PlayerName.GetData(), PlayerName.Len());
+}
+
+void FSAL_LeaderboardEntryStore::BuildRow(int32 Index, FSAL_LeaderboardEntryRow& OutRow) const
+{
+	const TConstArrayView<int32> Details = GetDetails(Index);
+	const FStringView Name = GetPlayerName(Index);
+
+	OutRow.SteamID    = LexToString(SteamIDs[Index]);
+	OutRow.GlobalRank = GlobalRanks[Index];
+	OutRow.Score      = Scores[Index];
+	OutRow.Details    = TArray<int32>(Details.GetData(), Details.Num());
+	OutRow.PlayerName = FString(Name.Len(), Name.GetData());
+
+	OutRow.UGCHandle.Value = static_cast<int64>(UGCHandles[Index]);
+	OutRow.bHasUGC         = OutRow.UGCHandle.IsValid();
+}
+
+SIZE_T FSAL_LeaderboardEntryStore::GetAllocatedSize() const
+{
+	return SteamIDs.GetAllocatedSize()
+		+ GlobalRanks.GetAllocatedSize()
+		+ Scores.GetAllocatedSize()
+		+ UGCHandles.GetAllocatedSize()
+		+ DetailsOffsets.GetAllocatedSize()
+		+ DetailsPool.GetAllocatedSize()
+		+ NameOffsets.GetAllocatedSize()
+		+ NameLengths.GetAllocatedSize()
+		+ NameTable.GetAllocatedSize();
+}
+
+uint32 FSAL_LeaderboardEntryStore::ComputeContentHash() const
+{
+	uint32 Crc = 0;
+	Crc = FCrc::MemCrc32(SteamIDs.GetData(), SteamIDs.Num() * SteamIDs.GetTypeSize(), Crc);
+	Crc = FCrc::MemCrc32(GlobalRanks.GetData(), GlobalRanks.Num() * GlobalRanks.GetTypeSize(), Crc);
+	Crc = FCrc::MemCrc32(Scores.GetData(), Scores.Num() * Scores.GetTypeSize(), Crc);
+	Crc = FCrc::MemCrc32(UGCHandles.GetData(), UGCHandles.Num() * UGCHandles.GetTypeSize(), Crc);
+	Crc = FCrc::MemCrc32(DetailsOffsets.GetData(), DetailsOffsets.Num() * DetailsOffsets.GetTypeSize(), Crc);
+	Crc = FCrc::MemCrc32(DetailsPool.GetData(), DetailsPool.Num() * DetailsPool.GetTypeSize(), Crc);
+
+	// Names may have been patched in place, so hash them per row rather than the raw table.
+	for (int32 i = 0; i < Num(); ++i)
+	{
+		const FStringView Name = GetPlayerName(i);
+		Crc = FCrc::MemCrc32(Name.GetData(), Name.Len() * sizeof(TCHAR), Crc);
+	}
+
+	return Crc;
+}
@@ -0,0 +1,445 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardHistory.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+namespace SAL_History
+{
+	static constexpr uint32 kMagic = 0x484C4153; // "SALH"
+	static constexpr uint32 kVersion = 1;
+	static constexpr int64 kHeaderSize = 8;
+
+	static void WriteVarint(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(static_cast<uint8>(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(static_cast<uint8>(Value));
+	}
+
+	static void WriteZigZag(TArray<uint8>& Out, int64 Value)
+	{
+		WriteVarint(Out, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+	}
+
+	static bool ReadVarint(const uint8*& Cursor, const uint8* End, uint64& OutValue)
+	{
+		OutValue = 0;
+
+		for (int32 Shift = 0; Shift < 64 && Cursor < End; Shift += 7)
+		{
+			const uint8 Byte = *Cursor++;
+			OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+
+			if ((Byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	static bool ReadZigZag(const uint8*& Cursor, const uint8* End, int64& OutValue)
+	{
+		uint64 Raw = 0;
+		if (!ReadVarint(Cursor, End, Raw))
+		{
+			return false;
+		}
+
+		OutValue = static_cast<int64>(Raw >> 1) ^ -static_cast<int64>(Raw & 1);
+		return true;
+	}
+
+	/** Reads a varint directly from an archive (frame sizes are read before their payload). */
+	static bool ReadVarint(FArchive& Ar, uint64& OutValue)
+	{
+		OutValue = 0;
+
+		for (int32 Shift = 0; Shift < 64 && !Ar.AtEnd(); Shift += 7)
+		{
+			uint8 Byte = 0;
+			Ar.Serialize(&Byte, 1);
+
+			if (Ar.IsError())
+			{
+				return false;
+			}
+
+			OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+
+			if ((Byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+FSAL_LeaderboardHistoryReader::~FSAL_LeaderboardHistoryReader()
+{
+	if (Reader.IsValid())
+	{
+		Reader->Close();
+	}
+}
+
+bool FSAL_LeaderboardHistoryReader::Open(const FString& Path)
+{
+	Reader.Reset(IFileManager::Get().CreateFileReader(*Path));
+	State = SAL_History::FState();
+	ValidSize = 0;
+
+	if (!Reader.IsValid())
+	{
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*Reader << Magic;
+	*Reader << Version;
+
+	if (Reader->IsError() || Magic != SAL_History::kMagic || Version != SAL_History::kVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardHistory: '%s' is not a version %u archive"), *Path, SAL_History::kVersion);
+		Reader.Reset();
+		return false;
+	}
+
+	ValidSize = SAL_History::kHeaderSize;
+	return true;
+}
+
+bool FSAL_LeaderboardHistoryReader::Next()
+{
+	using namespace SAL_History;
+
+	if (!Reader.IsValid() || Reader->AtEnd())
+	{
+		return false;
+	}
+
+	const int64 FrameStart = Reader->Tell();
+
+	uint64 PayloadSize = 0;
+	if (!ReadVarint(*Reader, PayloadSize) || PayloadSize > static_cast<uint64>(Reader->TotalSize() - Reader->Tell()))
+	{
+		return false;
+	}
+
+	Payload.SetNumUninitialized(static_cast<int32>(PayloadSize));
+	Reader->Serialize(Payload.GetData(), Payload.Num());
+	if (Reader->IsError())
+	{
+		return false;
+	}
+
+	const uint8* Cursor = Payload.GetData();
+	const uint8* End = Cursor + Payload.Num();
+
+	int64 TimestampDelta = 0;
+	uint64 NumNewIDs = 0;
+	if (!ReadZigZag(Cursor, End, TimestampDelta) || !ReadVarint(Cursor, End, NumNewIDs)
+		|| NumNewIDs > static_cast<uint64>(End - Cursor) / sizeof(uint64))
+	{
+		return false;
+	}
+
+	for (uint64 i = 0; i < NumNewIDs; ++i)
+	{
+		uint64 SteamID = 0;
+		FMemory::Memcpy(&SteamID, Cursor, sizeof(uint64));
+		Cursor += sizeof(uint64);
+		State.Dictionary.Add(SteamID);
+	}
+
+	uint64 NumRows = 0;
+	if (!ReadVarint(Cursor, End, NumRows) || NumRows > static_cast<uint64>(End - Cursor))
+	{
+		return false;
+	}
+
+	SteamIDs.Reset(static_cast<int32>(NumRows));
+	Ranks.Reset(static_cast<int32>(NumRows));
+	Scores.Reset(static_cast<int32>(NumRows));
+
+	TMap<int32, FIntPoint> Current;
+	Current.Reserve(static_cast<int32>(NumRows));
+
+	int32 PrevRowRank = 0;
+
+	for (uint64 Row = 0; Row < NumRows; ++Row)
+	{
+		uint64 Tag = 0;
+		int64 RankValue = 0;
+		int64 ScoreValue = 0;
+
+		if (!ReadVarint(Cursor, End, Tag) || !ReadZigZag(Cursor, End, RankValue) || !ReadZigZag(Cursor, End, ScoreValue))
+		{
+			return false;
+		}
+
+		const int32 DictIndex = static_cast<int32>(Tag >> 1);
+		if (!State.Dictionary.IsValidIndex(DictIndex))
+		{
+			return false;
+		}
+
+		int32 Rank = 0;
+		int32 Score = 0;
+
+		if (Tag & 1)
+		{
+			const FIntPoint* Prev = State.Previous.Find(DictIndex);
+			if (Prev == nullptr)
+			{
+				return false;
+			}
+
+			Rank = Prev->X + static_cast<int32>(RankValue);
+			Score = Prev->Y + static_cast<int32>(ScoreValue);
+		}
+		else
+		{
+			Rank = PrevRowRank + static_cast<int32>(RankValue);
+			Score = static_cast<int32>(ScoreValue);
+		}
+
+		PrevRowRank = Rank;
+
+		SteamIDs.Add(State.Dictionary[DictIndex]);
+		Ranks.Add(Rank);
+		Scores.Add(Score);
+		Current.Add(DictIndex, FIntPoint(Rank, Score));
+	}
+
+	State.Previous = MoveTemp(Current);
+	State.LastTimestamp += TimestampDelta;
+	++State.NumFrames;
+
+	ValidSize = Reader->Tell();
+	check(ValidSize > FrameStart);
+
+	return true;
+}
+
+void FSAL_LeaderboardHistoryReader::BuildStore(FSAL_LeaderboardEntryStore& Store) const
+{
+	Store.Reserve(Store.Num() + SteamIDs.Num());
+
+	for (int32 i = 0; i < SteamIDs.Num(); ++i)
+	{
+		Store.AddRow(SteamIDs[i], Ranks[i], Scores[i], 0, nullptr, 0, FStringView());
+	}
+}
+
+bool FSAL_LeaderboardHistoryReader::RebuildAt(const FString& Path, int64 TimestampUnix, FSAL_LeaderboardEntryStore& Store,
+                                              int64& OutFrameTimestamp)
+{
+	FSAL_LeaderboardHistoryReader HistoryReader;
+	if (!HistoryReader.Open(Path))
+	{
+		return false;
+	}
+
+	// Frames are decoded into reader state; keep the last one not after TimestampUnix.
+	FSAL_LeaderboardHistoryReader Best;
+	bool bFound = false;
+
+	while (HistoryReader.Next())
+	{
+		if (HistoryReader.GetTimestamp() > TimestampUnix)
+		{
+			break;
+		}
+
+		Best.SteamIDs = HistoryReader.SteamIDs;
+		Best.Ranks = HistoryReader.Ranks;
+		Best.Scores = HistoryReader.Scores;
+		OutFrameTimestamp = HistoryReader.GetTimestamp();
+		bFound = true;
+	}
+
+	if (bFound)
+	{
+		Best.BuildStore(Store);
+	}
+
+	return bFound;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool FSAL_LeaderboardHistoryWriter::Open(const FString& InPath)
+{
+	using namespace SAL_History;
+
+	Path = InPath;
+	State = FState();
+	bOpen = false;
+
+	IFileManager& FileManager = IFileManager::Get();
+
+	if (!FileManager.FileExists(*Path))
+	{
+		TArray<uint8> Header;
+		Header.Append(reinterpret_cast<const uint8*>(&kMagic), sizeof(uint32));
+		Header.Append(reinterpret_cast<const uint8*>(&kVersion), sizeof(uint32));
+
+		FileManager.MakeDirectory(*FPaths::GetPath(Path), true);
+		bOpen = FFileHelper::SaveArrayToFile(Header, *Path);
+		return bOpen;
+	}
+
+	int64 ValidSize = 0;
+	{
+		FSAL_LeaderboardHistoryReader HistoryReader;
+		if (!HistoryReader.Open(Path))
+		{
+			return false;
+		}
+
+		while (HistoryReader.Next())
+		{
+		}
+
+		State = HistoryReader.State;
+		ValidSize = HistoryReader.GetValidSize();
+	}
+
+	for (int32 i = 0; i < State.Dictionary.Num(); ++i)
+	{
+		State.DictionaryLookup.Add(State.Dictionary[i], i);
+	}
+
+	const int64 FileSize = FileManager.FileSize(*Path);
+	if (FileSize > ValidSize)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardHistory: dropping %lld bytes of a torn frame in '%s'"), FileSize - ValidSize, *Path);
+
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+		{
+			return false;
+		}
+
+		Bytes.SetNum(static_cast<int32>(ValidSize));
+		if (!FFileHelper::SaveArrayToFile(Bytes, *Path))
+		{
+			return false;
+		}
+	}
+
+	bOpen = true;
+	return true;
+}
+
+bool FSAL_LeaderboardHistoryWriter::Append(const FSAL_LeaderboardEntryStore& Store, int64 TimestampUnix)
+{
+	using namespace SAL_History;
+
+	if (!bOpen)
+	{
+		return false;
+	}
+
+	const int32 NumRows = Store.Num();
+
+	TArray<uint8> NewIDs;
+	TArray<uint8> Rows;
+	Rows.Reserve(NumRows * 4);
+
+	TMap<int32, FIntPoint> Current;
+	Current.Reserve(NumRows);
+
+	const int32 FirstNewIndex = State.Dictionary.Num();
+	int32 PrevRowRank = 0;
+
+	for (int32 i = 0; i < NumRows; ++i)
+	{
+		const uint64 SteamID = Store.GetSteamID(i);
+		const int32 Rank = Store.GetGlobalRank(i);
+		const int32 Score = Store.GetScore(i);
+
+		int32 DictIndex = INDEX_NONE;
+		if (const int32* Found = State.DictionaryLookup.Find(SteamID))
+		{
+			DictIndex = *Found;
+		}
+		else
+		{
+			DictIndex = State.Dictionary.Add(SteamID);
+			State.DictionaryLookup.Add(SteamID, DictIndex);
+			NewIDs.Append(reinterpret_cast<const uint8*>(&SteamID), sizeof(uint64));
+		}
+
+		if (const FIntPoint* Prev = State.Previous.Find(DictIndex))
+		{
+			WriteVarint(Rows, (static_cast<uint64>(DictIndex) << 1) | 1);
+			WriteZigZag(Rows, static_cast<int64>(Rank) - Prev->X);
+			WriteZigZag(Rows, static_cast<int64>(Score) - Prev->Y);
+		}
+		else
+		{
+			WriteVarint(Rows, static_cast<uint64>(DictIndex) << 1);
+			WriteZigZag(Rows, static_cast<int64>(Rank) - PrevRowRank);
+			WriteZigZag(Rows, Score);
+		}
+
+		PrevRowRank = Rank;
+		Current.Add(DictIndex, FIntPoint(Rank, Score));
+	}
+
+	TArray<uint8> Payload;
+	Payload.Reserve(16 + NewIDs.Num() + Rows.Num());
+	WriteZigZag(Payload, TimestampUnix - State.LastTimestamp);
+	WriteVarint(Payload, (State.Dictionary.Num() - FirstNewIndex));
+	Payload.Append(NewIDs);
+	WriteVarint(Payload, NumRows);
+	Payload.Append(Rows);
+
+	TArray<uint8> Frame;
+	Frame.Reserve(10 + Payload.Num());
+	WriteVarint(Frame, Payload.Num());
+	Frame.Append(Payload);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append));
+	bool bWritten = false;
+
+	if (Writer.IsValid())
+	{
+		Writer->Serialize(Frame.GetData(), Frame.Num());
+		bWritten = Writer->Close();
+	}
+
+	if (!bWritten)
+	{
+		// Roll the dictionary back so the next append re-adds these IDs.
+		for (int32 i = FirstNewIndex; i < State.Dictionary.Num(); ++i)
+		{
+			State.DictionaryLookup.Remove(State.Dictionary[i]);
+		}
+		State.Dictionary.SetNum(FirstNewIndex);
+
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardHistory: failed to append to '%s'"), *Path);
+		return false;
+	}
+
+	State.Previous = MoveTemp(Current);
+	State.LastTimestamp = TimestampUnix;
+	++State.NumFrames;
+
+	return true;
+}
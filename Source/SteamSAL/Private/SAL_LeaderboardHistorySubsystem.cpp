@@ -0,0 +1,132 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardHistorySubsystem.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_LeaderboardHistory.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+USAL_LeaderboardHistorySubsystem* USAL_LeaderboardHistorySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_LeaderboardHistorySubsystem>() : nullptr;
+}
+
+void USAL_LeaderboardHistorySubsystem::Deinitialize()
+{
+	Writers.Empty();
+	Super::Deinitialize();
+}
+
+bool USAL_LeaderboardHistorySubsystem::AppendSnapshot(const FString& ArchiveName, const FSAL_LeaderboardEntriesData& EntriesData,
+                                                      float MinIntervalSeconds)
+{
+	if (!EntriesData.Store.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardHistory: entries have no rows to archive"));
+		return false;
+	}
+
+	FSAL_LeaderboardHistoryWriter* Writer = FindOrOpenWriter(ArchiveName);
+	if (Writer == nullptr)
+	{
+		return false;
+	}
+
+	const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+	if (Writer->GetNumFrames() > 0 && Now - Writer->GetLastTimestamp() < static_cast<int64>(MinIntervalSeconds))
+	{
+		return false;
+	}
+
+	return Writer->Append(*EntriesData.Store, Now);
+}
+
+bool USAL_LeaderboardHistorySubsystem::GetSnapshotAt(const FString& ArchiveName, int64 TimestampUnix,
+                                                     FSAL_LeaderboardEntriesData& EntriesData, int64& SnapshotTimestampUnix)
+{
+	EntriesData = FSAL_LeaderboardEntriesData();
+	EntriesData.RequestType = ELeaderboardRequestType::Global;
+	SnapshotTimestampUnix = 0;
+
+	const FString Path = GetArchivePath(ArchiveName);
+	if (Path.IsEmpty())
+	{
+		return false;
+	}
+
+	FSAL_LeaderboardEntryStorePtr Store = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+	if (!FSAL_LeaderboardHistoryReader::RebuildAt(Path, TimestampUnix, *Store, SnapshotTimestampUnix))
+	{
+		return false;
+	}
+
+	EntriesData.Store = Store;
+	EntriesData.TotalEntryCount = Store->Num();
+	return true;
+}
+
+bool USAL_LeaderboardHistorySubsystem::GetSnapshotTimestamps(const FString& ArchiveName, TArray<int64>& TimestampsUnix)
+{
+	TimestampsUnix.Reset();
+
+	FSAL_LeaderboardHistoryReader Reader;
+	if (!Reader.Open(GetArchivePath(ArchiveName)))
+	{
+		return false;
+	}
+
+	while (Reader.Next())
+	{
+		TimestampsUnix.Add(Reader.GetTimestamp());
+	}
+
+	return true;
+}
+
+FString USAL_LeaderboardHistorySubsystem::GetArchivePath(const FString& ArchiveName) const
+{
+	if (ArchiveName.IsEmpty() || SteamUtils() == nullptr)
+	{
+		return FString();
+	}
+
+	return FPaths::ProjectSavedDir() / TEXT("SteamSAL") / TEXT("History") / LexToString(SteamUtils()->GetAppID())
+		/ (FPaths::MakeValidFileName(ArchiveName) + TEXT(".salh"));
+}
+
+FSAL_LeaderboardHistoryWriter* USAL_LeaderboardHistorySubsystem::FindOrOpenWriter(const FString& ArchiveName)
+{
+	if (const TSharedPtr<FSAL_LeaderboardHistoryWriter>* Existing = Writers.Find(ArchiveName))
+	{
+		return Existing->Get();
+	}
+
+	const FString Path = GetArchivePath(ArchiveName);
+	if (Path.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardHistory: invalid archive name or Steam not available"));
+		return nullptr;
+	}
+
+	TSharedPtr<FSAL_LeaderboardHistoryWriter> Writer = MakeShared<FSAL_LeaderboardHistoryWriter>();
+	if (!Writer->Open(Path))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardHistory: cannot open '%s'"), *Path);
+		return nullptr;
+	}
+
+	Writers.Add(ArchiveName, Writer);
+	return Writer.Get();
+}
@@ -0,0 +1,428 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardRegistrySubsystem.h"
+#include "SAL_Internal.h"
+#include "SteamSALBlueprintLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static const TCHAR* SAL_RegistryFileHeader = TEXT("SALREG 1");
+
+USAL_LeaderboardRegistrySubsystem* USAL_LeaderboardRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_LeaderboardRegistrySubsystem>() : nullptr;
+}
+
+void USAL_LeaderboardRegistrySubsystem::Deinitialize()
+{
+	Save();
+
+	PendingFinds.Empty();
+	Batches.Empty();
+	Known.Empty();
+
+	Super::Deinitialize();
+}
+
+void USAL_LeaderboardRegistrySubsystem::ResolveBoards(const TArray<FString>& LeaderboardNames, bool bForceRefresh,
+                                                      FOnBoardsResolved OnResolved)
+{
+	check(IsInGameThread());
+	EnsureLoaded();
+
+	const int32 BatchId = NextBatchId++;
+	FBatch& Batch = Batches.Add(BatchId);
+	Batch.OnResolved = MoveTemp(OnResolved);
+
+	for (const FString& Name : LeaderboardNames)
+	{
+		const bool bDuplicate = Name.IsEmpty() || Batch.Names.ContainsByPredicate([&Name](const FString& Other)
+		{
+			return Other.Equals(Name, ESearchCase::CaseSensitive);
+		});
+
+		if (bDuplicate)
+		{
+			continue;
+		}
+
+		Batch.Names.Add(Name);
+
+		if (!bForceRefresh && Known.Contains(Name))
+		{
+			continue;
+		}
+
+		if (const TSharedPtr<FPendingFind>* Existing = PendingFinds.Find(Name))
+		{
+			(*Existing)->BatchIds.Add(BatchId);
+			++Batch.NumPending;
+			continue;
+		}
+
+		if (SteamUserStats() == nullptr)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardRegistry: SteamUserStats not available, cannot resolve '%s'"), *Name);
+			continue;
+		}
+
+		const FTCHARToUTF8 NameUTF8(*Name);
+		const SteamAPICall_t Call = SteamUserStats()->FindLeaderboard(NameUTF8.Get());
+		if (Call == k_uAPICallInvalid)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardRegistry: Steam returned invalid APICall for '%s'"), *Name);
+			continue;
+		}
+
+		TSharedPtr<FPendingFind> Pending = MakeShared<FPendingFind>();
+		Pending->BatchIds.Add(BatchId);
+		PendingFinds.Add(Name, Pending);
+		++Batch.NumPending;
+
+		TWeakObjectPtr<USAL_LeaderboardRegistrySubsystem> Self(this);
+
+		Pending->Call.Set(Call, [Self, Name](LeaderboardFindResult_t* Result, bool bIOFailure)
+		{
+			const bool bFound = !bIOFailure && Result != nullptr && Result->m_bLeaderboardFound && Result->m_hSteamLeaderboard != 0;
+			const uint64 Handle = bFound ? static_cast<uint64>(Result->m_hSteamLeaderboard) : 0;
+
+			SAL_RunOnGameThread([Self, Name, bFound, Handle]()
+			{
+				if (!Self.IsValid()) return;
+				Self->OnFindCompleted(Name, bFound, Handle);
+			});
+		});
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("[SAL] LeaderboardRegistry: resolving %d names, %d queried on Steam"),
+	       Batch.Names.Num(), Batch.NumPending);
+
+	if (Batch.NumPending == 0)
+	{
+		FinishBatch(BatchId);
+	}
+}
+
+void USAL_LeaderboardRegistrySubsystem::OnFindCompleted(const FString& LeaderboardName, bool bFound, uint64 Handle)
+{
+	TSharedPtr<FPendingFind> Pending;
+	if (!PendingFinds.RemoveAndCopyValue(LeaderboardName, Pending) || !Pending.IsValid())
+	{
+		return;
+	}
+
+	if (bFound)
+	{
+		FSAL_LeaderboardHandle HandleWrapper;
+		HandleWrapper.Value = static_cast<int64>(Handle);
+		Register(LeaderboardName, HandleWrapper);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardRegistry: leaderboard '%s' not found"), *LeaderboardName);
+
+		if (Known.Remove(LeaderboardName) > 0)
+		{
+			bDirty = true;
+		}
+	}
+
+	for (const int32 BatchId : Pending->BatchIds)
+	{
+		FBatch* Batch = Batches.Find(BatchId);
+		if (Batch && --Batch->NumPending == 0)
+		{
+			FinishBatch(BatchId);
+		}
+	}
+}
+
+void USAL_LeaderboardRegistrySubsystem::FinishBatch(int32 BatchId)
+{
+	FBatch Batch;
+	if (!Batches.RemoveAndCopyValue(BatchId, Batch))
+	{
+		return;
+	}
+
+	Save();
+
+	TArray<FSAL_LeaderboardInfo> Found;
+	TArray<FString> Missing;
+
+	for (const FString& Name : Batch.Names)
+	{
+		if (const FSAL_LeaderboardInfo* Info = Known.Find(Name))
+		{
+			Found.Add(*Info);
+		}
+		else
+		{
+			Missing.Add(Name);
+		}
+	}
+
+	if (Batch.OnResolved)
+	{
+		Batch.OnResolved(Found, Missing);
+	}
+}
+
+void USAL_LeaderboardRegistrySubsystem::Register(const FString& LeaderboardName, FSAL_LeaderboardHandle LeaderboardHandle)
+{
+	if (LeaderboardName.IsEmpty() || LeaderboardHandle.Value == 0)
+	{
+		return;
+	}
+
+	EnsureLoaded();
+
+	FSAL_LeaderboardInfo& Info = Known.FindOrAdd(LeaderboardName);
+	Info.LeaderboardName   = LeaderboardName;
+	Info.LeaderboardHandle = LeaderboardHandle;
+	Snapshot(Info);
+
+	bDirty = true;
+}
+
+void USAL_LeaderboardRegistrySubsystem::RecordFromCallback(const UObject* WorldContextObject,
+                                                           const FString& LeaderboardName,
+                                                           FSAL_LeaderboardHandle LeaderboardHandle)
+{
+	// Call-result handlers may run on the Steam callback thread; the registry lives on the GameThread.
+	TWeakObjectPtr<const UObject> WeakContext(WorldContextObject);
+
+	SAL_RunOnGameThread([WeakContext, LeaderboardName, LeaderboardHandle]()
+	{
+		if (USAL_LeaderboardRegistrySubsystem* Registry = Get(WeakContext.Get()))
+		{
+			Registry->Register(LeaderboardName, LeaderboardHandle);
+		}
+	});
+}
+
+bool USAL_LeaderboardRegistrySubsystem::FindKnown(const FString& LeaderboardName, FSAL_LeaderboardInfo& Info)
+{
+	EnsureLoaded();
+
+	if (const FSAL_LeaderboardInfo* Found = Known.Find(LeaderboardName))
+	{
+		Info = *Found;
+		return true;
+	}
+
+	Info = FSAL_LeaderboardInfo();
+	return false;
+}
+
+bool USAL_LeaderboardRegistrySubsystem::FindSortMethod(FSAL_LeaderboardHandle LeaderboardHandle,
+                                                       ESALLeaderboardSortMethod& SortMethod)
+{
+	if (LeaderboardHandle.Value == 0)
+	{
+		return false;
+	}
+
+	if (SteamUserStats() != nullptr && SteamUserStats()->GetLeaderboardName((SteamLeaderboard_t)LeaderboardHandle.Value)[0] != '\0')
+	{
+		SortMethod = USteamSALBlueprintLibrary::GetLeaderboardSortMethod(LeaderboardHandle);
+		return true;
+	}
+
+	EnsureLoaded();
+
+	for (const TPair<FString, FSAL_LeaderboardInfo>& Pair : Known)
+	{
+		if (Pair.Value.LeaderboardHandle.Value == LeaderboardHandle.Value)
+		{
+			SortMethod = Pair.Value.SortMethod;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+TArray<FSAL_LeaderboardInfo> USAL_LeaderboardRegistrySubsystem::GetAllKnown()
+{
+	EnsureLoaded();
+
+	TArray<FSAL_LeaderboardInfo> Result;
+	Known.GenerateValueArray(Result);
+	return Result;
+}
+
+bool USAL_LeaderboardRegistrySubsystem::RefreshInfo(const FString& LeaderboardName, FSAL_LeaderboardInfo& Info)
+{
+	EnsureLoaded();
+
+	FSAL_LeaderboardInfo* Found = Known.Find(LeaderboardName);
+	if (Found == nullptr)
+	{
+		Info = FSAL_LeaderboardInfo();
+		return false;
+	}
+
+	Snapshot(*Found);
+	Info = *Found;
+
+	bDirty = true;
+	Save();
+	return true;
+}
+
+void USAL_LeaderboardRegistrySubsystem::Forget(const FString& LeaderboardName)
+{
+	EnsureLoaded();
+
+	if (Known.Remove(LeaderboardName) > 0)
+	{
+		bDirty = true;
+		Save();
+	}
+}
+
+void USAL_LeaderboardRegistrySubsystem::ClearRegistry()
+{
+	Known.Empty();
+	bLoaded = true;
+	bDirty = false;
+
+	const FString Path = GetRegistryFilePath();
+	if (!Path.IsEmpty())
+	{
+		IFileManager::Get().Delete(*Path, false, false, true);
+	}
+}
+
+void USAL_LeaderboardRegistrySubsystem::Snapshot(FSAL_LeaderboardInfo& Info) const
+{
+	// Steam only knows a handle's metadata after it was found this session; keep the old snapshot otherwise.
+	if (SteamUserStats() == nullptr || SteamUserStats()->GetLeaderboardName((SteamLeaderboard_t)Info.LeaderboardHandle.Value)[0] == '\0')
+	{
+		return;
+	}
+
+	Info.SortMethod  = USteamSALBlueprintLibrary::GetLeaderboardSortMethod(Info.LeaderboardHandle);
+	Info.DisplayType = USteamSALBlueprintLibrary::GetLeaderboardDisplayType(Info.LeaderboardHandle);
+	Info.EntryCount  = USteamSALBlueprintLibrary::GetLeaderboardEntryCount(Info.LeaderboardHandle);
+}
+
+FString USAL_LeaderboardRegistrySubsystem::GetRegistryFilePath() const
+{
+	if (SteamUtils() == nullptr)
+	{
+		return FString();
+	}
+
+	// Handles are only meaningful for the app that found them.
+	const uint32 AppID = SteamUtils()->GetAppID();
+	return FPaths::ProjectSavedDir() / TEXT("SteamSAL") / FString::Printf(TEXT("LeaderboardRegistry_%u.txt"), AppID);
+}
+
+void USAL_LeaderboardRegistrySubsystem::EnsureLoaded()
+{
+	if (bLoaded || !bPersistToDisk)
+	{
+		return;
+	}
+
+	const FString Path = GetRegistryFilePath();
+	if (Path.IsEmpty())
+	{
+		// Steam is not up yet; try again on the next call.
+		return;
+	}
+
+	bLoaded = true;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Path) || Lines.Num() == 0 || Lines[0] != SAL_RegistryFileHeader)
+	{
+		return;
+	}
+
+	for (int32 i = 1; i < Lines.Num(); ++i)
+	{
+		TArray<FString> Fields;
+		Lines[i].ParseIntoArray(Fields, TEXT("\t"), false);
+
+		uint64 Handle = 0;
+		if (Fields.Num() != 5 || Fields[0].IsEmpty() || !LexTryParseString<uint64>(Handle, *Fields[1]) || Handle == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardRegistry: skipping malformed line %d in '%s'"), i + 1, *Path);
+			continue;
+		}
+
+		// A name resolved this session before Steam came up wins over the saved one.
+		if (Known.Contains(Fields[0]))
+		{
+			continue;
+		}
+
+		FSAL_LeaderboardInfo& Info = Known.Add(Fields[0]);
+		Info.LeaderboardName         = Fields[0];
+		Info.LeaderboardHandle.Value = static_cast<int64>(Handle);
+		Info.SortMethod  = FCString::Atoi(*Fields[2]) == static_cast<int32>(ESALLeaderboardSortMethod::Ascending)
+			                   ? ESALLeaderboardSortMethod::Ascending
+			                   : ESALLeaderboardSortMethod::Descending;
+		Info.DisplayType = static_cast<ESALLeaderboardDisplayType>(
+			FMath::Clamp(FCString::Atoi(*Fields[3]), 0, static_cast<int32>(ESALLeaderboardDisplayType::TimeMilliSeconds)));
+		Info.EntryCount  = FCString::Atoi(*Fields[4]);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[SAL] LeaderboardRegistry: loaded %d known leaderboards"), Known.Num());
+}
+
+void USAL_LeaderboardRegistrySubsystem::Save()
+{
+	if (!bDirty || !bPersistToDisk)
+	{
+		return;
+	}
+
+	const FString Path = GetRegistryFilePath();
+	if (Path.IsEmpty())
+	{
+		return;
+	}
+
+	FString Text = SAL_RegistryFileHeader;
+	Text += LINE_TERMINATOR;
+
+	for (const auto& Pair : Known)
+	{
+		const FSAL_LeaderboardInfo& Info = Pair.Value;
+
+		if (Info.LeaderboardName.Contains(TEXT("\t")) || Info.LeaderboardName.Contains(TEXT("\n")))
+		{
+			continue;
+		}
+
+		Text += FString::Printf(TEXT("%s\t%lld\t%d\t%d\t%d"),
+		                        *Info.LeaderboardName,
+		                        Info.LeaderboardHandle.Value,
+		                        static_cast<int32>(Info.SortMethod),
+		                        static_cast<int32>(Info.DisplayType),
+		                        Info.EntryCount);
+		Text += LINE_TERMINATOR;
+	}
+
+	if (FFileHelper::SaveStringToFile(Text, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		bDirty = false;
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardRegistry: failed to write '%s'"), *Path);
+	}
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardSnapshot.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace SAL_Snapshot
+{
+	struct FLayout
+	{
+		int64 SteamIDs = 0;
+		int64 UGCHandles = 0;
+		int64 GlobalRanks = 0;
+		int64 Scores = 0;
+		int64 DetailsOffsets = 0;
+		int64 Details = 0;
+		int64 NameOffsets = 0;
+		int64 NameLengths = 0;
+		int64 Names = 0;
+		int64 TotalSize = 0;
+	};
+
+	static int64 Align8(int64 Offset)
+	{
+		return (Offset + 7) & ~int64(7);
+	}
+
+	static FLayout ComputeLayout(const FSAL_LeaderboardSnapshotHeader& Header)
+	{
+		const int64 Rows = Header.NumRows;
+		FLayout Layout;
+
+		int64 Offset = Align8(sizeof(FSAL_LeaderboardSnapshotHeader));
+		Layout.SteamIDs       = Offset; Offset = Align8(Offset + Rows * sizeof(uint64));
+		Layout.UGCHandles     = Offset; Offset = Align8(Offset + Rows * sizeof(uint64));
+		Layout.GlobalRanks    = Offset; Offset = Align8(Offset + Rows * sizeof(int32));
+		Layout.Scores         = Offset; Offset = Align8(Offset + Rows * sizeof(int32));
+		Layout.DetailsOffsets = Offset; Offset = Align8(Offset + (Rows + 1) * sizeof(int32));
+		Layout.Details        = Offset; Offset = Align8(Offset + int64(Header.NumDetails) * sizeof(int32));
+		Layout.NameOffsets    = Offset; Offset = Align8(Offset + Rows * sizeof(int32));
+		Layout.NameLengths    = Offset; Offset = Align8(Offset + Rows * sizeof(int32));
+		Layout.Names          = Offset; Offset = Align8(Offset + int64(Header.NumNameChars) * Header.CharSize);
+		Layout.TotalSize      = Offset;
+
+		return Layout;
+	}
+
+	template<typename T>
+	static void WriteColumn(TArray<uint8>& Bytes, int64 Offset, const T* Data, int64 Count)
+	{
+		if (Count > 0)
+		{
+			FMemory::Memcpy(Bytes.GetData() + Offset, Data, Count * sizeof(T));
+		}
+	}
+}
+
+TArray<uint8> FSAL_LeaderboardSnapshotWriter::Write(const FSAL_LeaderboardQueryKey& Key,
+                                                    const FSAL_LeaderboardEntryStore& Store, int64 SavedAtUnix)
+{
+	const int32 NumRows = Store.Num();
+
+	// Names are written compacted: patched names leave dead characters in the store's table.
+	TArray<int32> NameOffsets;
+	TArray<int32> NameLengths;
+	TArray<TCHAR> Names;
+	NameOffsets.Reserve(NumRows);
+	NameLengths.Reserve(NumRows);
+
+	for (int32 i = 0; i < NumRows; ++i)
+	{
+		const FStringView Name = Store.GetPlayerName(i);
+		NameOffsets.Add(Names.Num());
+		NameLengths.Add(Name.Len());
+		Names.Append(Name.GetData(), Name.Len());
+	}
+
+	FSAL_LeaderboardSnapshotHeader Header;
+	Header.Handle       = Key.Handle;
+	Header.SavedAtUnix  = SavedAtUnix;
+	Header.RequestType  = static_cast<int32>(Key.RequestType);
+	Header.RangeStart   = Key.RangeStart;
+	Header.RangeEnd     = Key.RangeEnd;
+	Header.DetailsMax   = Key.DetailsMax;
+	Header.NumRows      = NumRows;
+	Header.NumDetails   = Store.GetDetailsPool().Num();
+	Header.NumNameChars = Names.Num();
+	Header.ContentHash  = Store.ComputeContentHash();
+
+	const SAL_Snapshot::FLayout Layout = SAL_Snapshot::ComputeLayout(Header);
+
+	TArray<uint8> Bytes;
+	Bytes.SetNumZeroed(static_cast<int32>(Layout.TotalSize));
+
+	FMemory::Memcpy(Bytes.GetData(), &Header, sizeof(Header));
+	SAL_Snapshot::WriteColumn(Bytes, Layout.SteamIDs, Store.GetSteamIDColumn().GetData(), NumRows);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.UGCHandles, Store.GetUGCHandleColumn().GetData(), NumRows);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.GlobalRanks, Store.GetGlobalRankColumn().GetData(), NumRows);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.Scores, Store.GetScoreColumn().GetData(), NumRows);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.DetailsOffsets, Store.GetDetailsOffsetsColumn().GetData(), NumRows + 1);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.Details, Store.GetDetailsPool().GetData(), Header.NumDetails);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.NameOffsets, NameOffsets.GetData(), NumRows);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.NameLengths, NameLengths.GetData(), NumRows);
+	SAL_Snapshot::WriteColumn(Bytes, Layout.Names, Names.GetData(), Names.Num());
+
+	return Bytes;
+}
+
+TSharedPtr<FSAL_LeaderboardSnapshotView> FSAL_LeaderboardSnapshotView::Open(const FString& Path)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Path))
+	{
+		return nullptr;
+	}
+
+	// Every consumer copies the rows into an entry store, so mapping the file would save nothing; read it in one go.
+	TSharedPtr<FSAL_LeaderboardSnapshotView> View(new FSAL_LeaderboardSnapshotView());
+	if (!FFileHelper::LoadFileToArray(View->OwnedBytes, *Path))
+	{
+		return nullptr;
+	}
+
+	if (!View->Bind(View->OwnedBytes.GetData(), View->OwnedBytes.Num()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardSnapshot: '%s' is not a valid snapshot (ignored)"), *Path);
+		return nullptr;
+	}
+
+	return View;
+}
+
+bool FSAL_LeaderboardSnapshotView::Bind(const uint8* Data, int64 Size)
+{
+	if (Data == nullptr || Size < static_cast<int64>(sizeof(FSAL_LeaderboardSnapshotHeader)))
+	{
+		return false;
+	}
+
+	const FSAL_LeaderboardSnapshotHeader* InHeader = reinterpret_cast<const FSAL_LeaderboardSnapshotHeader*>(Data);
+	if (InHeader->Magic != FSAL_LeaderboardSnapshotHeader::kMagic
+		|| InHeader->Version != FSAL_LeaderboardSnapshotHeader::kVersion
+		|| InHeader->CharSize != sizeof(TCHAR)
+		|| InHeader->NumRows < 0 || InHeader->NumDetails < 0 || InHeader->NumNameChars < 0)
+	{
+		return false;
+	}
+
+	const SAL_Snapshot::FLayout Layout = SAL_Snapshot::ComputeLayout(*InHeader);
+	if (Layout.TotalSize > Size)
+	{
+		return false;
+	}
+
+	Header         = InHeader;
+	SteamIDs       = reinterpret_cast<const uint64*>(Data + Layout.SteamIDs);
+	UGCHandles     = reinterpret_cast<const uint64*>(Data + Layout.UGCHandles);
+	GlobalRanks    = reinterpret_cast<const int32*>(Data + Layout.GlobalRanks);
+	Scores         = reinterpret_cast<const int32*>(Data + Layout.Scores);
+	DetailsOffsets = reinterpret_cast<const int32*>(Data + Layout.DetailsOffsets);
+	Details        = reinterpret_cast<const int32*>(Data + Layout.Details);
+	NameOffsets    = reinterpret_cast<const int32*>(Data + Layout.NameOffsets);
+	NameLengths    = reinterpret_cast<const int32*>(Data + Layout.NameLengths);
+	Names          = reinterpret_cast<const TCHAR*>(Data + Layout.Names);
+
+	// Offsets come from disk; reject any that would read outside their pools.
+	for (int32 i = 0; i < Header->NumRows; ++i)
+	{
+		if (DetailsOffsets[i] < 0 || DetailsOffsets[i] > DetailsOffsets[i + 1] || DetailsOffsets[i + 1] > Header->NumDetails
+			|| NameOffsets[i] < 0 || NameLengths[i] < 0 || NameOffsets[i] + NameLengths[i] > Header->NumNameChars)
+		{
+			Header = nullptr;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+TConstArrayView<int32> FSAL_LeaderboardSnapshotView::GetDetails(int32 Index) const
+{
+	return TConstArrayView<int32>(Details + DetailsOffsets[Index], DetailsOffsets[Index + 1] - DetailsOffsets[Index]);
+}
+
+FStringView FSAL_LeaderboardSnapshotView::GetPlayerName(int32 Index) const
+{
+	return FStringView(Names + NameOffsets[Index], NameLengths[Index]);
+}
+
+void FSAL_LeaderboardSnapshotView::BuildRow(int32 Index, FSAL_LeaderboardEntryRow& OutRow) const
+{
+	const TConstArrayView<int32> RowDetails = GetDetails(Index);
+	const FStringView Name = GetPlayerName(Index);
+
+	OutRow.SteamID    = LexToString(SteamIDs[Index]);
+	OutRow.GlobalRank = GlobalRanks[Index];
+	OutRow.Score      = Scores[Index];
+	OutRow.Details    = TArray<int32>(RowDetails.GetData(), RowDetails.Num());
+	OutRow.PlayerName = FString(Name.Len(), Name.GetData());
+
+	OutRow.UGCHandle.Value = static_cast<int64>(UGCHandles[Index]);
+	OutRow.bHasUGC         = OutRow.UGCHandle.IsValid();
+}
+
+void FSAL_LeaderboardSnapshotView::CopyTo(FSAL_LeaderboardEntryStore& Store) const
+{
+	Store.Reserve(Store.Num() + Header->NumRows, Store.GetDetailsPool().Num() + Header->NumDetails, Header->NumNameChars);
+
+	for (int32 i = 0; i < Header->NumRows; ++i)
+	{
+		const TConstArrayView<int32> RowDetails = GetDetails(i);
+		Store.AddRow(SteamIDs[i], GlobalRanks[i], Scores[i], UGCHandles[i],
+		             RowDetails.GetData(), RowDetails.Num(), GetPlayerName(i));
+	}
+}
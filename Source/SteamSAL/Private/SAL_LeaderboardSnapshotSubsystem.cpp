@@ -0,0 +1,197 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardSnapshotSubsystem.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_LeaderboardSnapshot.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+USAL_LeaderboardSnapshotSubsystem* USAL_LeaderboardSnapshotSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_LeaderboardSnapshotSubsystem>() : nullptr;
+}
+
+void USAL_LeaderboardSnapshotSubsystem::Deinitialize()
+{
+	KnownMissing.Empty();
+
+	Super::Deinitialize();
+}
+
+TSharedPtr<const FSAL_LeaderboardSnapshotView> USAL_LeaderboardSnapshotSubsystem::FindSnapshot(const FSAL_LeaderboardQueryKey& Key)
+{
+	if (KnownMissing.Contains(Key))
+	{
+		return nullptr;
+	}
+
+	const FString Path = GetSnapshotPath(Key);
+	TSharedPtr<const FSAL_LeaderboardSnapshotView> View = Path.IsEmpty() ? nullptr : FSAL_LeaderboardSnapshotView::Open(Path);
+
+	if (!View.IsValid())
+	{
+		KnownMissing.Add(Key);
+		return nullptr;
+	}
+
+	return View;
+}
+
+bool USAL_LeaderboardSnapshotSubsystem::LoadEntries(const FSAL_LeaderboardQueryKey& Key,
+                                                    FSAL_LeaderboardEntriesData& EntriesData, int64* OutSavedAtUnix)
+{
+	const TSharedPtr<const FSAL_LeaderboardSnapshotView> View = FindSnapshot(Key);
+	if (!View.IsValid())
+	{
+		return false;
+	}
+
+	EntriesData = FSAL_LeaderboardEntriesData();
+	EntriesData.RequestType = Key.RequestType;
+	EntriesData.Store = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+	View->CopyTo(*EntriesData.Store);
+	EntriesData.TotalEntryCount = EntriesData.Store->Num();
+
+	if (OutSavedAtUnix)
+	{
+		*OutSavedAtUnix = View->GetHeader().SavedAtUnix;
+	}
+
+	return true;
+}
+
+void USAL_LeaderboardSnapshotSubsystem::SaveEntries(const FSAL_LeaderboardQueryKey& Key,
+                                                    const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	const FString Path = GetSnapshotPath(Key);
+	if (Path.IsEmpty() || !EntriesData.Store.IsValid())
+	{
+		return;
+	}
+
+	// Serialize here: the store may be patched on the GameThread (persona names) while the worker runs.
+	TArray<uint8> Bytes = FSAL_LeaderboardSnapshotWriter::Write(Key, *EntriesData.Store, FDateTime::UtcNow().ToUnixTimestamp());
+
+	KnownMissing.Remove(Key);
+
+	const FString TempPath = FPaths::CreateTempFilename(*FPaths::GetPath(Path), TEXT("sals"), TEXT(".tmp"));
+	const int32 MaxFiles = MaxSnapshotFiles;
+
+	Async(EAsyncExecution::ThreadPool, [Bytes = MoveTemp(Bytes), Path, TempPath, MaxFiles]()
+	{
+		const FString Dir = FPaths::GetPath(Path);
+		IFileManager::Get().MakeDirectory(*Dir, true);
+
+		// Write to a temp file and move it over, so a crash never leaves a half-written snapshot.
+		if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] LeaderboardSnapshot: failed to write '%s'"), *Path);
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+			return;
+		}
+
+		if (MaxFiles <= 0)
+		{
+			return;
+		}
+
+		TArray<FString> Files;
+		IFileManager::Get().FindFiles(Files, *(Dir / TEXT("*.sals")), true, false);
+
+		if (Files.Num() <= MaxFiles)
+		{
+			return;
+		}
+
+		TArray<TPair<FDateTime, FString>> ByAge;
+		ByAge.Reserve(Files.Num());
+
+		for (const FString& File : Files)
+		{
+			const FString FilePath = Dir / File;
+			ByAge.Emplace(IFileManager::Get().GetTimeStamp(*FilePath), FilePath);
+		}
+
+		ByAge.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B) { return A.Key < B.Key; });
+
+		for (int32 i = 0; i < ByAge.Num() - MaxFiles; ++i)
+		{
+			IFileManager::Get().Delete(*ByAge[i].Value, false, false, true);
+		}
+	});
+}
+
+void USAL_LeaderboardSnapshotSubsystem::AutoSnapshot(const FSAL_LeaderboardQueryKey& Key,
+                                                     const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	if (bAutoSnapshot)
+	{
+		SaveEntries(Key, EntriesData);
+	}
+}
+
+bool USAL_LeaderboardSnapshotSubsystem::GetSnapshotEntries(FSAL_LeaderboardHandle LeaderboardHandle,
+                                                           ELeaderboardRequestType RequestType, int32 RangeStart,
+                                                           int32 RangeEnd, FSAL_LeaderboardEntriesData& EntriesData,
+                                                           int64& SavedAtUnix, int32 DetailsMax)
+{
+	EntriesData = FSAL_LeaderboardEntriesData();
+	EntriesData.RequestType = RequestType;
+	SavedAtUnix = 0;
+
+	if (LeaderboardHandle.Value == 0)
+	{
+		return false;
+	}
+
+	const FSAL_LeaderboardQueryKey Key(LeaderboardHandle, RequestType, RangeStart, RangeEnd, DetailsMax);
+	return LoadEntries(Key, EntriesData, &SavedAtUnix);
+}
+
+void USAL_LeaderboardSnapshotSubsystem::DeleteAllSnapshots()
+{
+	KnownMissing.Empty();
+
+	const FString Dir = GetSnapshotDir();
+	if (!Dir.IsEmpty())
+	{
+		IFileManager::Get().DeleteDirectory(*Dir, false, true);
+	}
+}
+
+FString USAL_LeaderboardSnapshotSubsystem::GetSnapshotDir() const
+{
+	if (SteamUtils() == nullptr)
+	{
+		return FString();
+	}
+
+	return FPaths::ProjectSavedDir() / TEXT("SteamSAL") / TEXT("Snapshots") / LexToString(SteamUtils()->GetAppID());
+}
+
+FString USAL_LeaderboardSnapshotSubsystem::GetSnapshotPath(const FSAL_LeaderboardQueryKey& Key) const
+{
+	const FString Dir = GetSnapshotDir();
+	if (Dir.IsEmpty())
+	{
+		return FString();
+	}
+
+	return Dir / FString::Printf(TEXT("%lld_%d_%d_%d_%d.sals"),
+	                             Key.Handle, static_cast<int32>(Key.RequestType), Key.RangeStart, Key.RangeEnd, Key.DetailsMax);
+}
@@ -0,0 +1,291 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LeaderboardUploadQueueSubsystem.h"
+#include "SAL_Internal.h"
+#include "SAL_MyLeaderboardEntrySubsystem.h"
+#include "SAL_LeaderboardRegistrySubsystem.h"
+#include "SAL_RankPredictionSubsystem.h"
+#include "SAL_UploadJournalSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+USAL_LeaderboardUploadQueueSubsystem* USAL_LeaderboardUploadQueueSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_LeaderboardUploadQueueSubsystem>() : nullptr;
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Collection.InitializeDependency(USAL_LeaderboardRegistrySubsystem::StaticClass());
+	Collection.InitializeDependency(USAL_UploadJournalSubsystem::StaticClass());
+
+	Super::Initialize(Collection);
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USAL_LeaderboardUploadQueueSubsystem::Tick));
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	UploadCall.Cancel();
+
+	if (InFlight.IsSet())
+	{
+		Queue.Insert(InFlight.GetValue(), 0);
+	}
+
+	// Whatever Steam has not confirmed goes to the journal and is replayed next session.
+	if (Queue.Num() > 0)
+	{
+		USAL_UploadJournalSubsystem* Journal = GetGameInstance()->GetSubsystem<USAL_UploadJournalSubsystem>();
+		int32 NumLost = 0;
+
+		for (const FQueuedUpload& Upload : Queue)
+		{
+			if (Journal == nullptr || !Journal->JournalUpload(Upload.Handle, Upload.Score, Upload.Method, Upload.Details))
+			{
+				++NumLost;
+			}
+		}
+
+		if (NumLost > 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadQueue: %d queued upload(s) discarded on shutdown"), NumLost);
+		}
+	}
+
+	Queue.Empty();
+	InFlight.Reset();
+
+	Super::Deinitialize();
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::QueueUpload(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score,
+                                                       ESALLeaderboardUploadMethod UploadMethod,
+                                                       const TArray<int32>& Details)
+{
+	if (LeaderboardHandle.Value == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadQueue: Invalid LeaderboardHandle"));
+		return;
+	}
+
+	if (UploadMethod == ESALLeaderboardUploadMethod::KeepBestScore)
+	{
+		// Only the latest pending upload of this board may absorb the score; merging across a ForceUpdate would reorder them.
+		const int32 LastForBoard = Queue.FindLastByPredicate([&LeaderboardHandle](const FQueuedUpload& Upload)
+		{
+			return Upload.Handle.Value == LeaderboardHandle.Value;
+		});
+
+		// Guessing the sort method would keep the worse score on boards sorted the other way.
+		USAL_LeaderboardRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<USAL_LeaderboardRegistrySubsystem>();
+		ESALLeaderboardSortMethod SortMethod = ESALLeaderboardSortMethod::Descending;
+		const bool bKnownSort = Registry != nullptr && Registry->FindSortMethod(LeaderboardHandle, SortMethod);
+
+		if (bKnownSort && LastForBoard != INDEX_NONE && Queue[LastForBoard].Method == ESALLeaderboardUploadMethod::KeepBestScore)
+		{
+			FQueuedUpload& Pending = Queue[LastForBoard];
+			++NumDropped;
+
+			const bool bDescending = SortMethod == ESALLeaderboardSortMethod::Descending;
+			const bool bBetter = bDescending ? Score > Pending.Score : Score < Pending.Score;
+
+			if (bBetter)
+			{
+				// The queue time of the replaced score is kept, so latency still measures the player's wait.
+				Pending.Score = Score;
+				Pending.Details = Details;
+			}
+
+			UE_LOG(LogTemp, Verbose, TEXT("[SAL] UploadQueue: merged KeepBest score %d into pending %d (Handle=%lld)"),
+			       Score, Pending.Score, LeaderboardHandle.Value);
+			return;
+		}
+	}
+
+	FQueuedUpload& Upload = Queue.AddDefaulted_GetRef();
+	Upload.Handle = LeaderboardHandle;
+	Upload.Score = Score;
+	Upload.Method = UploadMethod;
+	Upload.Details = Details;
+	Upload.QueuedAt = FPlatformTime::Seconds();
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::FlushNow()
+{
+	if (bFlushing || Queue.Num() == 0)
+	{
+		return;
+	}
+
+	bFlushing = true;
+	SendNext();
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::GetQueueStats(int32& QueueDepth, int32& DroppedAsRedundant, int32& Uploaded,
+                                                         int32& Failed, float& AverageLatencySeconds,
+                                                         float& LastLatencySeconds) const
+{
+	QueueDepth = Queue.Num() + (InFlight.IsSet() ? 1 : 0);
+	DroppedAsRedundant = NumDropped;
+	Uploaded = NumUploaded;
+	Failed = NumFailed;
+
+	const int32 NumAnswered = NumUploaded + NumFailed;
+	AverageLatencySeconds = NumAnswered > 0 ? static_cast<float>(TotalLatency / NumAnswered) : 0.0f;
+	LastLatencySeconds = static_cast<float>(LastLatency);
+}
+
+bool USAL_LeaderboardUploadQueueSubsystem::Tick(float DeltaTime)
+{
+	// Retries after a failure run even without automatic flushes.
+	if (FlushIntervalSeconds <= 0.0f && NumConsecutiveFailures == 0)
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now >= NextFlushAt)
+	{
+		NextFlushAt = Now + FMath::Max(FlushIntervalSeconds, 0.0f);
+		FlushNow();
+	}
+
+	return true;
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::SendNext()
+{
+	if (Queue.Num() == 0)
+	{
+		bFlushing = false;
+		return;
+	}
+
+	// Keep everything queued while Steam is away; the next flush tries again.
+	if (SteamUserStats() == nullptr)
+	{
+		bFlushing = false;
+		return;
+	}
+
+	InFlight = Queue[0];
+	Queue.RemoveAt(0);
+
+	const FQueuedUpload& Upload = InFlight.GetValue();
+	const int32 DetailsCount = FMath::Clamp(Upload.Details.Num(), 0, 64);
+
+	const SteamAPICall_t Call = SteamUserStats()->UploadLeaderboardScore(
+		static_cast<SteamLeaderboard_t>(Upload.Handle.Value),
+		Upload.Method == ESALLeaderboardUploadMethod::ForceUpdate
+			? k_ELeaderboardUploadScoreMethodForceUpdate
+			: k_ELeaderboardUploadScoreMethodKeepBest,
+		Upload.Score,
+		DetailsCount > 0 ? Upload.Details.GetData() : nullptr,
+		DetailsCount);
+
+	if (Call == k_uAPICallInvalid)
+	{
+		OnUploaded(false, false, 0, false, TEXT("Steam returned an invalid API call handle."));
+		return;
+	}
+
+	TWeakObjectPtr<USAL_LeaderboardUploadQueueSubsystem> Self(this);
+
+	UploadCall.Set(Call, [Self](LeaderboardScoreUploaded_t* Result, bool bIOFailure)
+	{
+		const bool bIOError = bIOFailure || Result == nullptr;
+		const bool bOk = !bIOError && Result->m_bSuccess != 0;
+		const int32 NewGlobalRank = bOk ? Result->m_nGlobalRankNew : 0;
+		const bool bScoreChanged = bOk && Result->m_bScoreChanged != 0;
+
+		SAL_RunOnGameThread([Self, bOk, bIOError, NewGlobalRank, bScoreChanged]()
+		{
+			if (!Self.IsValid()) return;
+			Self->OnUploaded(bOk, !bOk && !bIOError, NewGlobalRank, bScoreChanged,
+			                 bOk ? FString() : bIOError ? TEXT("Steam IO failure.") : TEXT("UploadLeaderboardScore was rejected."));
+		});
+	});
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::OnUploaded(bool bOk, bool bRejected, int32 NewGlobalRank, bool bScoreChanged,
+                                                      const FString& Error)
+{
+	if (!InFlight.IsSet())
+	{
+		return;
+	}
+
+	FQueuedUpload Upload = InFlight.GetValue();
+	InFlight.Reset();
+
+	if (!bOk)
+	{
+		if (bRejected)
+		{
+			++Upload.Attempts;
+		}
+
+		if (!bRejected || Upload.Attempts < MaxUploadAttempts)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadQueue: upload failed, retrying later (Handle=%lld, Score=%d): %s"),
+			       Upload.Handle.Value, Upload.Score, *Error);
+
+			RetryLater(MoveTemp(Upload));
+			return;
+		}
+	}
+
+	NumConsecutiveFailures = 0;
+
+	LastLatency = FPlatformTime::Seconds() - Upload.QueuedAt;
+	TotalLatency += LastLatency;
+
+	if (bOk)
+	{
+		++NumUploaded;
+
+		if (USAL_MyLeaderboardEntrySubsystem* MyEntry = GetGameInstance()->GetSubsystem<USAL_MyLeaderboardEntrySubsystem>())
+		{
+			MyEntry->RecordUpload(Upload.Handle.Value, Upload.Score, bScoreChanged, NewGlobalRank);
+		}
+
+		if (bScoreChanged && SteamUser() != nullptr)
+		{
+			if (USAL_RankPredictionSubsystem* Prediction = GetGameInstance()->GetSubsystem<USAL_RankPredictionSubsystem>())
+			{
+				Prediction->ApplyUpload(Upload.Handle.Value, SteamUser()->GetSteamID().ConvertToUint64(), Upload.Score, NewGlobalRank);
+			}
+		}
+	}
+	else
+	{
+		++NumFailed;
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadQueue: upload failed (Handle=%lld, Score=%d): %s"),
+		       Upload.Handle.Value, Upload.Score, *Error);
+	}
+
+	OnUploadCompleted.Broadcast(Upload.Handle, Upload.Score, bOk, NewGlobalRank);
+
+	SendNext();
+}
+
+void USAL_LeaderboardUploadQueueSubsystem::RetryLater(FQueuedUpload Upload)
+{
+	// Back at the head, so later uploads of its board still go out after it.
+	Queue.Insert(MoveTemp(Upload), 0);
+
+	++NumConsecutiveFailures;
+	const double Backoff = FMath::Min(FMath::Max(RetryBackoffSeconds, 0.1f) * FMath::Pow(2.0, NumConsecutiveFailures - 1), 60.0);
+
+	NextFlushAt = FPlatformTime::Seconds() + Backoff;
+	bFlushing = false;
+}
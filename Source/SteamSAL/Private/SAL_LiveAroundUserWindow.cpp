@@ -0,0 +1,277 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_LiveAroundUserWindow.h"
+#include "SAL_Internal.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_PersonaResolverSubsystem.h"
+#include "UObject/Package.h"
+
+USAL_LiveAroundUserWindow* USAL_LiveAroundUserWindow::CreateLiveAroundUserWindow(
+	UObject* WorldContextObject, FSAL_LeaderboardHandle LeaderboardHandle, int32 RowsAbove, int32 RowsBelow,
+	float RefreshIntervalSeconds, int32 DetailsMax)
+{
+	USAL_LiveAroundUserWindow* Window = NewObject<USAL_LiveAroundUserWindow>(
+		WorldContextObject ? WorldContextObject : static_cast<UObject*>(GetTransientPackage()));
+
+	Window->Handle = LeaderboardHandle;
+	Window->RowsAbove = FMath::Max(RowsAbove, 0);
+	Window->RowsBelow = FMath::Max(RowsBelow, 0);
+	Window->RefreshIntervalSeconds = RefreshIntervalSeconds;
+	Window->DetailsMax = FMath::Clamp(DetailsMax, 0, 64);
+	Window->Data.RequestType = ELeaderboardRequestType::GlobalAroundUser;
+
+	if (LeaderboardHandle.Value == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LiveAroundUserWindow: Invalid LeaderboardHandle"));
+	}
+
+	return Window;
+}
+
+void USAL_LiveAroundUserWindow::BeginDestroy()
+{
+	Stop();
+	ProbeCall.Cancel();
+
+	Super::BeginDestroy();
+}
+
+void USAL_LiveAroundUserWindow::Start()
+{
+	if (TickHandle.IsValid())
+	{
+		return;
+	}
+
+	NextRefreshAt = 0.0;
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USAL_LiveAroundUserWindow::Tick));
+}
+
+void USAL_LiveAroundUserWindow::Stop()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+}
+
+void USAL_LiveAroundUserWindow::GetStats(int32& Probes, int32& SkippedDownloads, int32& Downloads) const
+{
+	Probes = NumProbes;
+	SkippedDownloads = NumSkipped;
+	Downloads = NumDownloads;
+}
+
+bool USAL_LiveAroundUserWindow::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	if (!bBusy && Now >= NextRefreshAt)
+	{
+		NextRefreshAt = Now + FMath::Max(RefreshIntervalSeconds, 1.0f);
+		RefreshNow(false);
+	}
+
+	return true;
+}
+
+void USAL_LiveAroundUserWindow::RefreshNow(bool bForce)
+{
+	if (bBusy)
+	{
+		return;
+	}
+
+	if (Handle.Value == 0)
+	{
+		OnFailure.Broadcast(TEXT("Invalid LeaderboardHandle. Make sure FindLeaderboard succeeded."));
+		return;
+	}
+
+	bBusy = true;
+
+	if (bForce)
+	{
+		DownloadWindow();
+	}
+	else
+	{
+		StartProbe();
+	}
+}
+
+void USAL_LiveAroundUserWindow::StartProbe()
+{
+	if (SteamUserStats() == nullptr || SteamUser() == nullptr)
+	{
+		bBusy = false;
+		OnFailure.Broadcast(TEXT("SteamUserStats not available or not initialized."));
+		return;
+	}
+
+	++NumProbes;
+
+	CSteamID LocalUser = SteamUser()->GetSteamID();
+
+	const SteamAPICall_t ApiCall = SteamUserStats()->DownloadLeaderboardEntriesForUsers(
+		static_cast<SteamLeaderboard_t>(Handle.Value), &LocalUser, 1);
+
+	if (ApiCall == k_uAPICallInvalid)
+	{
+		bBusy = false;
+		OnFailure.Broadcast(TEXT("DownloadLeaderboardEntriesForUsers returned invalid call handle."));
+		return;
+	}
+
+	TWeakObjectPtr<USAL_LiveAroundUserWindow> Self(this);
+
+	ProbeCall.Set(ApiCall, [Self](LeaderboardScoresDownloaded_t* Callback, bool bIOFailure)
+	{
+		const bool bOk = !bIOFailure && Callback != nullptr && SteamUserStats() != nullptr;
+		int32 EntryCount = 0;
+		int32 OwnRank = 0;
+		int32 OwnScore = 0;
+
+		// Steam refreshes the entry count with every download, this probe included; read it only now.
+		if (bOk)
+		{
+			EntryCount = SteamUserStats()->GetLeaderboardEntryCount(Callback->m_hSteamLeaderboard);
+		}
+
+		if (bOk && Callback->m_cEntryCount > 0)
+		{
+			LeaderboardEntry_t Entry;
+			if (SteamUserStats()->GetDownloadedLeaderboardEntry(Callback->m_hSteamLeaderboardEntries, 0, &Entry, nullptr, 0))
+			{
+				OwnRank = Entry.m_nGlobalRank;
+				OwnScore = Entry.m_nScore;
+			}
+		}
+
+		SAL_RunOnGameThread([Self, EntryCount, bOk, OwnRank, OwnScore]()
+		{
+			if (!Self.IsValid()) return;
+			Self->OnProbed(EntryCount, bOk, OwnRank, OwnScore);
+		});
+	});
+}
+
+void USAL_LiveAroundUserWindow::OnProbed(int32 EntryCount, bool bOk, int32 OwnRank, int32 OwnScore)
+{
+	// A failed probe tells us nothing; fall through to the real download.
+	const bool bUnchanged = bOk
+		&& Data.Store.IsValid()
+		&& EntryCount == LastEntryCount
+		&& OwnRank == LastOwnRank
+		&& OwnScore == LastOwnScore;
+
+	const bool bForced = MaxConsecutiveSkips > 0 && ConsecutiveSkips >= MaxConsecutiveSkips;
+
+	if (bUnchanged && !bForced)
+	{
+		++ConsecutiveSkips;
+		++NumSkipped;
+		bBusy = false;
+		return;
+	}
+
+	if (bOk)
+	{
+		LastEntryCount = EntryCount;
+		LastOwnRank = OwnRank;
+		LastOwnScore = OwnScore;
+	}
+
+	DownloadWindow();
+}
+
+void USAL_LiveAroundUserWindow::DownloadWindow()
+{
+	ConsecutiveSkips = 0;
+	++NumDownloads;
+
+	const FSAL_LeaderboardQueryKey Key(Handle, ELeaderboardRequestType::GlobalAroundUser, -RowsAbove, RowsBelow, DetailsMax);
+
+	TWeakObjectPtr<USAL_LiveAroundUserWindow> Self(this);
+	FString Error;
+
+	const bool bRequested = FSAL_LeaderboardDownloadCoalescer::Get().Request(Key,
+		[Self](bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Why)
+		{
+			if (!Self.IsValid()) return;
+			Self->OnWindowDownloaded(bOk, EntriesData, Why);
+		},
+		Error);
+
+	if (!bRequested)
+	{
+		bBusy = false;
+		OnFailure.Broadcast(Error);
+	}
+}
+
+static bool SAL_SameRow(const FSAL_LeaderboardEntryStore& A, int32 IndexA, const FSAL_LeaderboardEntryStore& B, int32 IndexB)
+{
+	if (A.GetSteamID(IndexA) != B.GetSteamID(IndexB)
+		|| A.GetGlobalRank(IndexA) != B.GetGlobalRank(IndexB)
+		|| A.GetScore(IndexA) != B.GetScore(IndexB)
+		|| A.GetUGCHandle(IndexA) != B.GetUGCHandle(IndexB))
+	{
+		return false;
+	}
+
+	const TConstArrayView<int32> DetailsA = A.GetDetails(IndexA);
+	const TConstArrayView<int32> DetailsB = B.GetDetails(IndexB);
+
+	return DetailsA.Num() == DetailsB.Num()
+		&& FMemory::Memcmp(DetailsA.GetData(), DetailsB.GetData(), DetailsA.Num() * sizeof(int32)) == 0;
+}
+
+void USAL_LiveAroundUserWindow::OnWindowDownloaded(bool bOk, const FSAL_LeaderboardEntriesData& EntriesData,
+                                                   const FString& Error)
+{
+	bBusy = false;
+
+	if (!bOk)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] LiveAroundUserWindow: refresh failed: %s"), *Error);
+		OnFailure.Broadcast(Error);
+		return;
+	}
+
+	const FSAL_LeaderboardEntryStorePtr OldStore = Data.Store;
+	const FSAL_LeaderboardEntryStorePtr NewStore = EntriesData.GetOrBuildStore();
+
+	TArray<int32> ChangedIndices;
+	const int32 OldNum = OldStore.IsValid() ? OldStore->Num() : 0;
+	const int32 NewNum = NewStore->Num();
+
+	for (int32 i = 0; i < FMath::Max(OldNum, NewNum); ++i)
+	{
+		if (i >= OldNum || i >= NewNum || !SAL_SameRow(*OldStore, i, *NewStore, i))
+		{
+			ChangedIndices.Add(i);
+		}
+	}
+
+	// NewStore is shared with every other waiter on this download and is never written to here.
+	// An unchanged window keeps the old store and the names already resolved into it.
+	Data = EntriesData;
+	Data.Store = ChangedIndices.Num() == 0 && OldStore.IsValid() ? OldStore : NewStore;
+
+	if (ChangedIndices.Num() == 0)
+	{
+		return;
+	}
+
+	// Names missing from the new rows are filled in by the resolver; Steam's persona cache makes repeats cheap.
+	if (USAL_PersonaResolverSubsystem* Resolver = USAL_PersonaResolverSubsystem::Get(GetOuter()))
+	{
+		Resolver->Track(Data);
+	}
+
+	OnRowsChanged.Broadcast(ChangedIndices, NewNum);
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_MyLeaderboardEntrySubsystem.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+USAL_MyLeaderboardEntrySubsystem* USAL_MyLeaderboardEntrySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_MyLeaderboardEntrySubsystem>() : nullptr;
+}
+
+void USAL_MyLeaderboardEntrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	DownloadedHandle = FSAL_LeaderboardDownloadCoalescer::Get().OnDownloaded.AddUObject(
+		this, &USAL_MyLeaderboardEntrySubsystem::OnDownloaded);
+}
+
+void USAL_MyLeaderboardEntrySubsystem::Deinitialize()
+{
+	FSAL_LeaderboardDownloadCoalescer::Get().OnDownloaded.Remove(DownloadedHandle);
+
+	Entries.Empty();
+
+	Super::Deinitialize();
+}
+
+void USAL_MyLeaderboardEntrySubsystem::OnDownloaded(const FSAL_LeaderboardQueryKey& Key,
+                                                    const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	AddEntries(Key.Handle, EntriesData);
+}
+
+void USAL_MyLeaderboardEntrySubsystem::AddEntries(int64 Handle, const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	if (Handle == 0 || !EntriesData.Store.IsValid() || SteamUser() == nullptr)
+	{
+		return;
+	}
+
+	const uint64 MySteamID = SteamUser()->GetSteamID().ConvertToUint64();
+	const int32 Index = EntriesData.Store->GetSteamIDColumn().Find(MySteamID);
+
+	if (Index != INDEX_NONE)
+	{
+		const int32 Score = EntriesData.Store->GetScore(Index);
+		Update(Handle, EntriesData.Store->GetGlobalRank(Index), &Score);
+	}
+}
+
+void USAL_MyLeaderboardEntrySubsystem::RecordUpload(int64 Handle, int32 Score, bool bScoreChanged, int32 NewGlobalRank)
+{
+	if (Handle == 0 || NewGlobalRank <= 0)
+	{
+		return;
+	}
+
+	Update(Handle, NewGlobalRank, bScoreChanged ? &Score : nullptr);
+}
+
+void USAL_MyLeaderboardEntrySubsystem::Update(int64 Handle, int32 GlobalRank, const int32* Score)
+{
+	FMyEntry& Entry = Entries.FindOrAdd(Handle);
+
+	const bool bChanged = Entry.GlobalRank != GlobalRank || (Score != nullptr && (!Entry.bHasScore || Entry.Score != *Score));
+
+	Entry.GlobalRank = GlobalRank;
+	Entry.UpdatedAt = FPlatformTime::Seconds();
+
+	if (Score != nullptr)
+	{
+		Entry.Score = *Score;
+		Entry.bHasScore = true;
+	}
+
+	if (bChanged)
+	{
+		FSAL_LeaderboardHandle LeaderboardHandle;
+		LeaderboardHandle.Value = Handle;
+		OnMyEntryChanged.Broadcast(LeaderboardHandle, Entry.GlobalRank, Entry.Score);
+	}
+}
+
+bool USAL_MyLeaderboardEntrySubsystem::GetMyEntry(FSAL_LeaderboardHandle LeaderboardHandle, int32& GlobalRank, int32& Score,
+                                                  bool& bHasScore, float& AgeSeconds) const
+{
+	const FMyEntry* Entry = Entries.Find(LeaderboardHandle.Value);
+
+	GlobalRank = Entry ? Entry->GlobalRank : 0;
+	Score = Entry ? Entry->Score : 0;
+	bHasScore = Entry ? Entry->bHasScore : false;
+	AgeSeconds = Entry ? static_cast<float>(FPlatformTime::Seconds() - Entry->UpdatedAt) : 0.0f;
+
+	return Entry != nullptr;
+}
+
+void USAL_MyLeaderboardEntrySubsystem::ClearMyEntries()
+{
+	Entries.Empty();
+}
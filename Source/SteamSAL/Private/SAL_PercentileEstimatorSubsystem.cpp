@@ -0,0 +1,279 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_PercentileEstimatorSubsystem.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_LeaderboardRegistrySubsystem.h"
+#include "SteamSALBlueprintLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+// Sampling rounds run inside the gap around the queried score after the base curve.
+static constexpr int32 SAL_PercentileRefineRounds = 2;
+
+USAL_PercentileEstimatorSubsystem* USAL_PercentileEstimatorSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_PercentileEstimatorSubsystem>() : nullptr;
+}
+
+void USAL_PercentileEstimatorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Collection.InitializeDependency(USAL_LeaderboardRegistrySubsystem::StaticClass());
+
+	Super::Initialize(Collection);
+}
+
+void USAL_PercentileEstimatorSubsystem::Deinitialize()
+{
+	Curves.Empty();
+
+	Super::Deinitialize();
+}
+
+void USAL_PercentileEstimatorSubsystem::InvalidateCurve(FSAL_LeaderboardHandle LeaderboardHandle)
+{
+	Curves.Remove(LeaderboardHandle.Value);
+}
+
+void USAL_PercentileEstimatorSubsystem::Estimate(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score, int32 NumSamples,
+                                                 int32 RefineSamples, FOnEstimated OnEstimated)
+{
+	check(IsInGameThread());
+
+	TSharedRef<FEstimateRequest> Request = MakeShared<FEstimateRequest>();
+	Request->Handle = LeaderboardHandle;
+	Request->Score = Score;
+	Request->RefineSamples = FMath::Clamp(RefineSamples, 0, 16);
+	Request->RoundsLeft = Request->RefineSamples > 0 ? SAL_PercentileRefineRounds : 0;
+	Request->OnEstimated = MoveTemp(OnEstimated);
+
+	// Steam's own getter reports Descending for handles it has not found this session; never guess the order.
+	ESALLeaderboardSortMethod SortMethod = ESALLeaderboardSortMethod::Descending;
+	USAL_LeaderboardRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<USAL_LeaderboardRegistrySubsystem>();
+	if (Registry == nullptr || !Registry->FindSortMethod(LeaderboardHandle, SortMethod))
+	{
+		Request->OnEstimated(false, FEstimate(), TEXT("Sort method of the leaderboard is unknown. Find the leaderboard first."));
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	if (const TSharedPtr<FCurve>* Existing = Curves.Find(LeaderboardHandle.Value))
+	{
+		const TSharedPtr<FCurve> Curve = *Existing;
+		if (Curve->Index.GetSortMethod() == SortMethod)
+		{
+			if (Curve->bSampling)
+			{
+				Request->Curve = Curve;
+				Curve->Waiting.Add(Request);
+				return;
+			}
+
+			if (Now - Curve->SampledAt <= CurveTTLSeconds)
+			{
+				Request->Curve = Curve;
+				RefineOrFinish(Request);
+				return;
+			}
+		}
+	}
+
+	const int32 TotalEntries = USteamSALBlueprintLibrary::GetLeaderboardEntryCount(LeaderboardHandle);
+	if (TotalEntries <= 0)
+	{
+		Request->OnEstimated(false, FEstimate(), TEXT("Leaderboard has no entries (or the handle is invalid)."));
+		return;
+	}
+
+	TSharedPtr<FCurve> Curve = MakeShared<FCurve>(SortMethod);
+	Curve->TotalEntries = TotalEntries;
+	Curve->SampledAt = Now;
+	Curves.Add(LeaderboardHandle.Value, Curve);
+	Request->Curve = Curve;
+
+	// Quadratic spacing puts most samples in the top percentiles, where badges are decided.
+	NumSamples = FMath::Clamp(NumSamples, 2, 32);
+
+	TArray<int32> Ranks;
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		const double Fraction = FMath::Square(double(i) / (NumSamples - 1));
+		Ranks.AddUnique(1 + FMath::RoundToInt(Fraction * (TotalEntries - 1)));
+	}
+
+	SampleRanks(Request, Ranks);
+}
+
+void USAL_PercentileEstimatorSubsystem::SampleRanks(const TSharedRef<FEstimateRequest>& Request, const TArray<int32>& Ranks)
+{
+	struct FRound
+	{
+		int32 Pending = 0;
+		int32 NumOk = 0;
+		FString LastError;
+	};
+
+	TSharedRef<FRound> Round = MakeShared<FRound>();
+	Round->Pending = Ranks.Num();
+
+	TWeakObjectPtr<USAL_PercentileEstimatorSubsystem> Self(this);
+
+	auto OnSampleDone = [Self, Request, Round](bool bOk, const FString& Error)
+	{
+		if (bOk)
+		{
+			++Round->NumOk;
+		}
+		else
+		{
+			Round->LastError = Error;
+		}
+
+		if (--Round->Pending > 0 || !Self.IsValid())
+		{
+			return;
+		}
+
+		if (Request->Curve->bSampling)
+		{
+			Self->OnBaseSampled(Request, Round->NumOk > 0, Round->LastError);
+			return;
+		}
+
+		Self->RefineOrFinish(Request);
+	};
+
+	for (const int32 Rank : Ranks)
+	{
+		const FSAL_LeaderboardQueryKey Key(Request->Handle, ELeaderboardRequestType::Global, Rank, Rank, 0);
+		++Request->NumRequests;
+
+		FString Error;
+		const bool bStarted = FSAL_LeaderboardDownloadCoalescer::Get().Request(Key,
+			[Request, OnSampleDone](bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Why)
+			{
+				if (bOk && EntriesData.Store.IsValid())
+				{
+					Request->Curve->Index.Insert(*EntriesData.Store);
+				}
+
+				OnSampleDone(bOk, Why);
+			},
+			Error);
+
+		if (!bStarted)
+		{
+			OnSampleDone(false, Error);
+		}
+	}
+}
+
+void USAL_PercentileEstimatorSubsystem::OnBaseSampled(const TSharedRef<FEstimateRequest>& Request, bool bAnySample,
+                                                      const FString& Error)
+{
+	const TSharedPtr<FCurve> Curve = Request->Curve;
+	Curve->bSampling = false;
+
+	TArray<TSharedRef<FEstimateRequest>> Requests;
+	Requests.Add(Request);
+	Requests.Append(MoveTemp(Curve->Waiting));
+
+	if (!bAnySample && Curve->Index.Num() == 0)
+	{
+		// Do not keep an empty curve around: the next estimate should sample the board again.
+		const TSharedPtr<FCurve>* Cached = Curves.Find(Request->Handle.Value);
+		if (Cached && *Cached == Curve)
+		{
+			Curves.Remove(Request->Handle.Value);
+		}
+
+		for (const TSharedRef<FEstimateRequest>& Failed : Requests)
+		{
+			Failed->OnEstimated(false, FEstimate(), Error);
+		}
+		return;
+	}
+
+	for (const TSharedRef<FEstimateRequest>& Waiter : Requests)
+	{
+		RefineOrFinish(Waiter);
+	}
+}
+
+void USAL_PercentileEstimatorSubsystem::RefineOrFinish(const TSharedRef<FEstimateRequest>& Request)
+{
+	if (Request->RoundsLeft <= 0)
+	{
+		Finish(Request);
+		return;
+	}
+
+	--Request->RoundsLeft;
+
+	const uint64 LocalSteamID = SteamUser() ? SteamUser()->GetSteamID().ConvertToUint64() : 0;
+
+	FSAL_ScoreRankIndex::FPrediction Prediction;
+	if (!Request->Curve->Index.PredictRank(Request->Score, Request->Curve->TotalEntries, LocalSteamID, Prediction)
+		|| Prediction.bExact)
+	{
+		Finish(Request);
+		return;
+	}
+
+	// Unknown ranks are [BestRank..WorstRank - 1]; split them evenly, the last rank is the board's end.
+	const int32 First = Prediction.BestRank;
+	const int32 Last = FMath::Min(Prediction.WorstRank - 1, Request->Curve->TotalEntries);
+
+	TArray<int32> Ranks;
+	for (int32 i = 1; i <= Request->RefineSamples && First <= Last; ++i)
+	{
+		const int32 Rank = First + FMath::RoundToInt(double(i) * (Last - First) / (Request->RefineSamples + 1));
+		Ranks.AddUnique(FMath::Clamp(Rank, First, Last));
+	}
+
+	if (Ranks.Num() == 0)
+	{
+		Finish(Request);
+		return;
+	}
+
+	SampleRanks(Request, Ranks);
+}
+
+void USAL_PercentileEstimatorSubsystem::Finish(const TSharedRef<FEstimateRequest>& Request)
+{
+	const uint64 LocalSteamID = SteamUser() ? SteamUser()->GetSteamID().ConvertToUint64() : 0;
+
+	FSAL_ScoreRankIndex::FPrediction Prediction;
+	if (!Request->Curve->Index.PredictRank(Request->Score, Request->Curve->TotalEntries, LocalSteamID, Prediction))
+	{
+		Request->OnEstimated(false, FEstimate(), TEXT("No leaderboard samples available."));
+		return;
+	}
+
+	FEstimate Estimate;
+	Estimate.Rank = Prediction.Rank;
+	Estimate.BestRank = Prediction.BestRank;
+	Estimate.WorstRank = Prediction.WorstRank;
+	Estimate.bExact = Prediction.bExact;
+	Estimate.NumRequests = Request->NumRequests;
+	Estimate.TotalEntries = FMath::Max(Request->Curve->TotalEntries, Prediction.Rank);
+	Estimate.TopPercent = 100.0f * Estimate.Rank / Estimate.TotalEntries;
+
+	UE_LOG(LogTemp, Verbose, TEXT("[SAL] PercentileEstimator: score %d ~ rank %d [%d..%d] of %d (top %.1f%%, %d requests)"),
+	       Request->Score, Estimate.Rank, Estimate.BestRank, Estimate.WorstRank, Estimate.TotalEntries,
+	       Estimate.TopPercent, Estimate.NumRequests);
+
+	Request->OnEstimated(true, Estimate, FString());
+}
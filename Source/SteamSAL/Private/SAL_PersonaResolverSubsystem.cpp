@@ -0,0 +1,230 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_PersonaResolverSubsystem.h"
+#include "SAL_Internal.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+USAL_PersonaResolverSubsystem* USAL_PersonaResolverSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_PersonaResolverSubsystem>() : nullptr;
+}
+
+void USAL_PersonaResolverSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PersonaStateChangeCallback.Register(this, &USAL_PersonaResolverSubsystem::OnPersonaStateChange);
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USAL_PersonaResolverSubsystem::Tick));
+}
+
+void USAL_PersonaResolverSubsystem::Deinitialize()
+{
+	PersonaStateChangeCallback.Unregister();
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
+	Watchers.Empty();
+	Queue.Empty();
+	Queued.Empty();
+	Requested.Empty();
+	Changed.Empty();
+
+	Super::Deinitialize();
+}
+
+void USAL_PersonaResolverSubsystem::Track(const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	const FSAL_LeaderboardEntryStorePtr& Store = EntriesData.Store;
+	if (!Store.IsValid())
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Store->Num(); ++i)
+	{
+		if (!Store->GetPlayerName(i).IsEmpty())
+		{
+			continue;
+		}
+
+		const uint64 SteamID = Store->GetSteamID(i);
+
+		TArray<FRowRef>& Rows = Watchers.FindOrAdd(SteamID);
+
+		const bool bAlreadyWatched = Rows.ContainsByPredicate([&Store, i](const FRowRef& Ref)
+		{
+			return Ref.RowIndex == i && Ref.Store.HasSameObject(Store.Get());
+		});
+
+		if (!bAlreadyWatched)
+		{
+			Rows.Add(FRowRef{ Store, i });
+		}
+
+		Enqueue(SteamID);
+	}
+}
+
+void USAL_PersonaResolverSubsystem::TrackEntries(const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	Track(EntriesData);
+}
+
+int32 USAL_PersonaResolverSubsystem::GetNumPending() const
+{
+	return Queue.Num() + Requested.Num();
+}
+
+void USAL_PersonaResolverSubsystem::Enqueue(uint64 SteamID)
+{
+	if (Queued.Contains(SteamID) || Requested.Contains(SteamID))
+	{
+		return;
+	}
+
+	Queued.Add(SteamID);
+	Queue.Add(SteamID);
+}
+
+void USAL_PersonaResolverSubsystem::OnPersonaStateChange(PersonaStateChange_t* Change)
+{
+	if (Change == nullptr || (Change->m_nChangeFlags & k_EPersonaChangeName) == 0)
+	{
+		return;
+	}
+
+	const uint64 SteamID = Change->m_ulSteamID;
+	TWeakObjectPtr<USAL_PersonaResolverSubsystem> Self(this);
+
+	SAL_RunOnGameThread([Self, SteamID]()
+	{
+		if (!Self.IsValid()) return;
+		Self->Changed.Add(SteamID);
+	});
+}
+
+bool USAL_PersonaResolverSubsystem::Tick(float DeltaTime)
+{
+	IssueRequests(DeltaTime);
+	ExpireRequests();
+	PatchChangedNames();
+	return true;
+}
+
+void USAL_PersonaResolverSubsystem::IssueRequests(float DeltaTime)
+{
+	if (Queue.Num() == 0 || SteamFriends() == nullptr)
+	{
+		return;
+	}
+
+	const double Rate = FMath::Max(MaxRequestsPerSecond, 0.1f);
+	RequestTokens = FMath::Min(RequestTokens + Rate * DeltaTime, Rate);
+
+	const double Now = FPlatformTime::Seconds();
+	int32 NumTaken = 0;
+
+	while (NumTaken < Queue.Num() && RequestTokens >= 1.0)
+	{
+		const uint64 SteamID = Queue[NumTaken++];
+		Queued.Remove(SteamID);
+
+		if (!Watchers.Contains(SteamID))
+		{
+			continue;
+		}
+
+		RequestTokens -= 1.0;
+
+		// Returns false when Steam already has the name cached; no PersonaStateChange_t will follow.
+		if (SteamFriends()->RequestUserInformation(CSteamID(SteamID), true))
+		{
+			Requested.Add(SteamID, Now);
+		}
+		else
+		{
+			Changed.Add(SteamID);
+		}
+	}
+
+	Queue.RemoveAt(0, NumTaken);
+}
+
+void USAL_PersonaResolverSubsystem::ExpireRequests()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (auto It = Requested.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value() > RequestTimeoutSeconds)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("[SAL] PersonaResolver: no name for %llu after %.0fs"),
+			       static_cast<unsigned long long>(It.Key()), RequestTimeoutSeconds);
+
+			Watchers.Remove(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void USAL_PersonaResolverSubsystem::PatchChangedNames()
+{
+	if (Changed.Num() == 0 || SteamFriends() == nullptr)
+	{
+		return;
+	}
+
+	TArray<FString> UpdatedIDs;
+
+	for (const uint64 SteamID : Changed)
+	{
+		const char* Persona = SteamFriends()->GetFriendPersonaName(CSteamID(SteamID));
+		if (Persona == nullptr || Persona[0] == '\0')
+		{
+			continue;
+		}
+
+		Requested.Remove(SteamID);
+
+		TArray<FRowRef> Rows;
+		if (!Watchers.RemoveAndCopyValue(SteamID, Rows))
+		{
+			continue;
+		}
+
+		const FUTF8ToTCHAR PersonaConv(Persona);
+		const FStringView Name(PersonaConv.Get(), PersonaConv.Length());
+		bool bPatchedAny = false;
+
+		for (const FRowRef& Ref : Rows)
+		{
+			const FSAL_LeaderboardEntryStorePtr Store = Ref.Store.Pin();
+			if (Store.IsValid() && Store->IsValidIndex(Ref.RowIndex) && Store->GetSteamID(Ref.RowIndex) == SteamID)
+			{
+				Store->SetPlayerName(Ref.RowIndex, Name);
+				bPatchedAny = true;
+			}
+		}
+
+		if (bPatchedAny)
+		{
+			UpdatedIDs.Add(LexToString(SteamID));
+		}
+	}
+
+	Changed.Reset();
+
+	if (UpdatedIDs.Num() > 0)
+	{
+		OnNamesUpdated.Broadcast(UpdatedIDs);
+	}
+}
@@ -0,0 +1,203 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_RankPredictionSubsystem.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_LeaderboardRegistrySubsystem.h"
+#include "SteamSALBlueprintLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+USAL_RankPredictionSubsystem* USAL_RankPredictionSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_RankPredictionSubsystem>() : nullptr;
+}
+
+void USAL_RankPredictionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Collection.InitializeDependency(USAL_LeaderboardRegistrySubsystem::StaticClass());
+
+	Super::Initialize(Collection);
+
+	DownloadedHandle = FSAL_LeaderboardDownloadCoalescer::Get().OnDownloaded.AddUObject(
+		this, &USAL_RankPredictionSubsystem::OnDownloaded);
+}
+
+void USAL_RankPredictionSubsystem::Deinitialize()
+{
+	FSAL_LeaderboardDownloadCoalescer::Get().OnDownloaded.Remove(DownloadedHandle);
+
+	Boards.Empty();
+
+	Super::Deinitialize();
+}
+
+USAL_RankPredictionSubsystem::FBoardState& USAL_RankPredictionSubsystem::FindOrAddBoard(int64 Handle)
+{
+	TUniquePtr<FBoardState>& Board = Boards.FindOrAdd(Handle);
+	if (!Board.IsValid())
+	{
+		// The sort method is settled in UpdateSortMethod before the index is queried.
+		Board = MakeUnique<FBoardState>(ESALLeaderboardSortMethod::Descending);
+	}
+
+	return *Board;
+}
+
+bool USAL_RankPredictionSubsystem::UpdateSortMethod(int64 Handle, FBoardState& Board) const
+{
+	FSAL_LeaderboardHandle LeaderboardHandle;
+	LeaderboardHandle.Value = Handle;
+
+	// Steam's own getter reports Descending for handles it has not found this session, which would invert
+	// every prediction on an Ascending board restored from the registry.
+	ESALLeaderboardSortMethod SortMethod = ESALLeaderboardSortMethod::Descending;
+	USAL_LeaderboardRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<USAL_LeaderboardRegistrySubsystem>();
+	if (Registry == nullptr || !Registry->FindSortMethod(LeaderboardHandle, SortMethod))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[SAL] RankPrediction: sort method unknown (Handle=%lld)"), Handle);
+		return false;
+	}
+
+	if (Board.Index.GetSortMethod() != SortMethod)
+	{
+		Board.Index.SetSortMethod(SortMethod);
+	}
+
+	return true;
+}
+
+void USAL_RankPredictionSubsystem::OnDownloaded(const FSAL_LeaderboardQueryKey& Key,
+                                                const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	AddEntries(Key.Handle, EntriesData);
+}
+
+void USAL_RankPredictionSubsystem::AddEntries(int64 Handle, const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	if (Handle == 0 || !EntriesData.Store.IsValid() || EntriesData.Store->Num() == 0)
+	{
+		return;
+	}
+
+	FindOrAddBoard(Handle).Index.Insert(*EntriesData.Store);
+}
+
+void USAL_RankPredictionSubsystem::ApplyUpload(int64 Handle, uint64 SteamID, int32 Score, int32 NewGlobalRank)
+{
+	if (Handle == 0 || NewGlobalRank <= 0)
+	{
+		return;
+	}
+
+	FBoardState& Board = FindOrAddBoard(Handle);
+
+	if (Board.bHasPrediction && Board.LastPredictedScore == Score)
+	{
+		Board.LastError = Board.LastPredictedRank - NewGlobalRank;
+		Board.bHasError = true;
+		Board.bHasPrediction = false;
+
+		UE_LOG(LogTemp, Verbose, TEXT("[SAL] RankPrediction: predicted %d, Steam returned %d (Handle=%lld, Score=%d)"),
+		       Board.LastPredictedRank, NewGlobalRank, Handle, Score);
+	}
+
+	Board.Index.ApplyUpload(SteamID, Score, NewGlobalRank);
+}
+
+bool USAL_RankPredictionSubsystem::PredictRank(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score,
+                                               int32& PredictedRank, int32& BestRank, int32& WorstRank, bool& bExact)
+{
+	PredictedRank = 0;
+	BestRank = 0;
+	WorstRank = 0;
+	bExact = false;
+
+	TUniquePtr<FBoardState>* Board = Boards.Find(LeaderboardHandle.Value);
+	if (Board == nullptr || !UpdateSortMethod(LeaderboardHandle.Value, **Board))
+	{
+		return false;
+	}
+
+	const uint64 LocalSteamID = SteamUser() ? SteamUser()->GetSteamID().ConvertToUint64() : 0;
+
+	FSAL_ScoreRankIndex::FPrediction Prediction;
+	if (!(*Board)->Index.PredictRank(Score, USteamSALBlueprintLibrary::GetLeaderboardEntryCount(LeaderboardHandle),
+	                                 LocalSteamID, Prediction))
+	{
+		return false;
+	}
+
+	PredictedRank = Prediction.Rank;
+	BestRank = Prediction.BestRank;
+	WorstRank = Prediction.WorstRank;
+	bExact = Prediction.bExact;
+
+	(*Board)->LastPredictedScore = Score;
+	(*Board)->LastPredictedRank = Prediction.Rank;
+	(*Board)->bHasPrediction = true;
+
+	return true;
+}
+
+bool USAL_RankPredictionSubsystem::GetEntriesAroundScore(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score,
+                                                         TArray<FSAL_LeaderboardEntryRow>& Entries,
+                                                         int32 NumAhead, int32 NumBehind)
+{
+	Entries.Reset();
+
+	const TUniquePtr<FBoardState>* Board = Boards.Find(LeaderboardHandle.Value);
+	if (Board == nullptr || !UpdateSortMethod(LeaderboardHandle.Value, **Board))
+	{
+		return false;
+	}
+
+	const FSAL_ScoreRankIndex& Index = (*Board)->Index;
+
+	TArray<int32> Indices;
+	Index.GetAdjacent(Score, NumAhead, NumBehind, Indices);
+
+	Entries.Reserve(Indices.Num());
+	for (const int32 i : Indices)
+	{
+		FSAL_LeaderboardEntryRow& Row = Entries.AddDefaulted_GetRef();
+		Row.SteamID = LexToString(Index.GetSteamID(i));
+		Row.GlobalRank = Index.GetRank(i);
+		Row.Score = Index.GetScore(i);
+
+		if (SteamFriends() != nullptr)
+		{
+			Row.PlayerName = UTF8_TO_TCHAR(SteamFriends()->GetFriendPersonaName(CSteamID(Index.GetSteamID(i))));
+		}
+	}
+
+	return Entries.Num() > 0;
+}
+
+bool USAL_RankPredictionSubsystem::GetLastPredictionError(FSAL_LeaderboardHandle LeaderboardHandle, int32& RankError) const
+{
+	RankError = 0;
+
+	const TUniquePtr<FBoardState>* Board = Boards.Find(LeaderboardHandle.Value);
+	if (Board == nullptr || !(*Board)->bHasError)
+	{
+		return false;
+	}
+
+	RankError = (*Board)->LastError;
+	return true;
+}
+
+void USAL_RankPredictionSubsystem::ClearPredictionData()
+{
+	Boards.Empty();
+}
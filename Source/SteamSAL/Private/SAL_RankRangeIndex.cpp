@@ -0,0 +1,194 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_RankRangeIndex.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "Algo/BinarySearch.h"
+
+static void SAL_CopyRankRange(const FSAL_LeaderboardEntryStore& Src, int32 First, int32 Last, FSAL_LeaderboardEntryStore& Dst)
+{
+	const TConstArrayView<int32> Ranks = Src.GetGlobalRankColumn();
+
+	for (int32 i = Algo::LowerBound(Ranks, First); i < Src.Num() && Src.GetGlobalRank(i) <= Last; ++i)
+	{
+		const TConstArrayView<int32> Details = Src.GetDetails(i);
+		Dst.AddRow(Src.GetSteamID(i), Src.GetGlobalRank(i), Src.GetScore(i), Src.GetUGCHandle(i),
+		           Details.GetData(), Details.Num(), Src.GetPlayerName(i));
+	}
+}
+
+int32 FSAL_RankRangeIndex::LowerBound(int32 Rank) const
+{
+	return Algo::LowerBoundBy(Segments, Rank, [](const FSegment& Segment) { return Segment.Last; });
+}
+
+void FSAL_RankRangeIndex::GetMissing(int32 First, int32 Last, double MaxAgeSeconds, TArray<FInt32Interval>& OutGaps) const
+{
+	const double Now = FPlatformTime::Seconds();
+	int32 Cursor = First;
+
+	for (int32 i = LowerBound(First); i < Segments.Num() && Cursor <= Last; ++i)
+	{
+		const FSegment& Segment = Segments[i];
+		if (Segment.First > Last)
+		{
+			break;
+		}
+
+		if (Now - Segment.FetchedAt > MaxAgeSeconds)
+		{
+			continue;
+		}
+
+		if (Segment.First > Cursor)
+		{
+			OutGaps.Add(FInt32Interval(Cursor, Segment.First - 1));
+		}
+
+		Cursor = FMath::Max(Cursor, Segment.Last + 1);
+	}
+
+	if (Cursor <= Last)
+	{
+		OutGaps.Add(FInt32Interval(Cursor, Last));
+	}
+}
+
+void FSAL_RankRangeIndex::Insert(int32 First, int32 Last, const FSAL_LeaderboardEntryStore& Rows)
+{
+	if (Last < First)
+	{
+		return;
+	}
+
+	TArray<FSegment> Remainders;
+
+	int32 Begin = LowerBound(First);
+	int32 End = Begin;
+
+	while (End < Segments.Num() && Segments[End].First <= Last)
+	{
+		const FSegment& Old = Segments[End];
+
+		if (Old.First < First)
+		{
+			FSegment& Left = Remainders.AddDefaulted_GetRef();
+			Left.First = Old.First;
+			Left.Last = First - 1;
+			Left.FetchedAt = Old.FetchedAt;
+			Left.LastReadAt = Old.LastReadAt;
+			Left.Rows = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+			SAL_CopyRankRange(*Old.Rows, Left.First, Left.Last, *Left.Rows);
+		}
+
+		if (Old.Last > Last)
+		{
+			FSegment& Right = Remainders.AddDefaulted_GetRef();
+			Right.First = Last + 1;
+			Right.Last = Old.Last;
+			Right.FetchedAt = Old.FetchedAt;
+			Right.LastReadAt = Old.LastReadAt;
+			Right.Rows = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+			SAL_CopyRankRange(*Old.Rows, Right.First, Right.Last, *Right.Rows);
+		}
+
+		++End;
+	}
+
+	FSegment Segment;
+	Segment.First = First;
+	Segment.Last = Last;
+	Segment.FetchedAt = FPlatformTime::Seconds();
+	Segment.LastReadAt = Segment.FetchedAt;
+	Segment.Rows = MakeShared<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>();
+	SAL_CopyRankRange(Rows, First, Last, *Segment.Rows);
+
+	// At most one left remainder (from the first overlapped segment) and one right remainder (from the last).
+	TArray<FSegment> Replacement;
+	for (FSegment& Remainder : Remainders)
+	{
+		if (Remainder.Last < First)
+		{
+			Replacement.Add(MoveTemp(Remainder));
+		}
+	}
+	Replacement.Add(MoveTemp(Segment));
+	for (FSegment& Remainder : Remainders)
+	{
+		if (Remainder.First > Last)
+		{
+			Replacement.Add(MoveTemp(Remainder));
+		}
+	}
+
+	Segments.RemoveAt(Begin, End - Begin);
+	Segments.Insert(MoveTemp(Replacement), Begin);
+}
+
+void FSAL_RankRangeIndex::Assemble(int32 First, int32 Last, FSAL_LeaderboardEntryStore& Out)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (int32 i = LowerBound(First); i < Segments.Num() && Segments[i].First <= Last; ++i)
+	{
+		SAL_CopyRankRange(*Segments[i].Rows, First, Last, Out);
+		Segments[i].LastReadAt = Now;
+	}
+}
+
+void FSAL_RankRangeIndex::Prune(double MaxAgeSeconds)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	Segments.RemoveAll([Now, MaxAgeSeconds](const FSegment& Segment)
+	{
+		return Now - Segment.FetchedAt > MaxAgeSeconds;
+	});
+}
+
+int32 FSAL_RankRangeIndex::FindOldestRead() const
+{
+	int32 Oldest = INDEX_NONE;
+
+	for (int32 i = 0; i < Segments.Num(); ++i)
+	{
+		if (Oldest == INDEX_NONE || Segments[i].LastReadAt < Segments[Oldest].LastReadAt)
+		{
+			Oldest = i;
+		}
+	}
+
+	return Oldest;
+}
+
+bool FSAL_RankRangeIndex::GetOldestRead(double& OutLastReadAt) const
+{
+	const int32 Oldest = FindOldestRead();
+	if (Oldest == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutLastReadAt = Segments[Oldest].LastReadAt;
+	return true;
+}
+
+void FSAL_RankRangeIndex::EvictOldest()
+{
+	const int32 Oldest = FindOldestRead();
+	if (Oldest != INDEX_NONE)
+	{
+		Segments.RemoveAt(Oldest);
+	}
+}
+
+SIZE_T FSAL_RankRangeIndex::GetAllocatedSize() const
+{
+	SIZE_T Bytes = Segments.GetAllocatedSize();
+
+	for (const FSegment& Segment : Segments)
+	{
+		Bytes += Segment.Rows->GetAllocatedSize();
+	}
+
+	return Bytes;
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_ResolveLeaderboards.h"
+#include "SAL_LeaderboardRegistrySubsystem.h"
+
+USAL_ResolveLeaderboards* USAL_ResolveLeaderboards::ResolveLeaderboards(
+	UObject* WorldContextObject,
+	const TArray<FString>& LeaderboardNames,
+	bool bForceRefresh)
+{
+	USAL_ResolveLeaderboards* Node = NewObject<USAL_ResolveLeaderboards>();
+
+	Node->RegisterWithGameInstance(WorldContextObject);
+
+	Node->WorldContextObject = WorldContextObject;
+	Node->InLeaderboardNames = LeaderboardNames;
+	Node->bInForceRefresh = bForceRefresh;
+
+	return Node;
+}
+
+void USAL_ResolveLeaderboards::Activate()
+{
+	if (InLeaderboardNames.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] ResolveLeaderboards: empty name list"));
+		OnFailure.Broadcast(TEXT("LeaderboardNames is empty."));
+		SetReadyToDestroy();
+		return;
+	}
+
+	USAL_LeaderboardRegistrySubsystem* Registry = USAL_LeaderboardRegistrySubsystem::Get(WorldContextObject);
+	if (Registry == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] ResolveLeaderboards: leaderboard registry not available"));
+		OnFailure.Broadcast(TEXT("Leaderboard registry not available (no GameInstance)."));
+		SetReadyToDestroy();
+		return;
+	}
+
+	TWeakObjectPtr<USAL_ResolveLeaderboards> Self(this);
+
+	Registry->ResolveBoards(InLeaderboardNames, bInForceRefresh,
+		[Self](const TArray<FSAL_LeaderboardInfo>& Found, const TArray<FString>& Missing)
+		{
+			if (!Self.IsValid()) return;
+
+			UE_LOG(LogTemp, Log, TEXT("[SAL] ResolveLeaderboards: %d found, %d missing"), Found.Num(), Missing.Num());
+			Self->OnCompleted.Broadcast(Found, Missing);
+			Self->SetReadyToDestroy();
+		});
+}
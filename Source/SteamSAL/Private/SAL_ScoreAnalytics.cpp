@@ -0,0 +1,427 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_ScoreAnalytics.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#define SAL_SCORE_SSE2 1
+#include <emmintrin.h>
+#else
+#define SAL_SCORE_SSE2 0
+#endif
+
+namespace SAL_ScoreKernels
+{
+	using FSummary = FSAL_ScoreAnalytics::FSummary;
+
+	// Shared by both paths so the bucket of a score never depends on which kernel ran.
+	FORCEINLINE double ClampBucket(double Bucket, int32 NumBuckets)
+	{
+		return FMath::Clamp(Bucket, 0.0, double(NumBuckets - 1));
+	}
+
+	static FSummary SummarizeScalar(const int32* Data, int32 Num)
+	{
+		FSummary Summary;
+		Summary.Count = Num;
+		Summary.Min = MAX_int32;
+		Summary.Max = MIN_int32;
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Summary.Min = FMath::Min(Summary.Min, Data[i]);
+			Summary.Max = FMath::Max(Summary.Max, Data[i]);
+			Summary.Sum += Data[i];
+		}
+
+		return Summary;
+	}
+
+	static void HistogramScalar(const int32* Data, int32 Num, int32 Min, double Scale, int32 NumBuckets, int32* Counts)
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			++Counts[int32(ClampBucket((double(Data[i]) - double(Min)) * Scale, NumBuckets))];
+		}
+	}
+
+	static int32 CountBelowScalar(const int32* Data, int32 Num, int32 Threshold)
+	{
+		int32 Count = 0;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Count += Data[i] < Threshold ? 1 : 0;
+		}
+		return Count;
+	}
+
+	static int32 CountAboveScalar(const int32* Data, int32 Num, int32 Threshold)
+	{
+		int32 Count = 0;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Count += Data[i] > Threshold ? 1 : 0;
+		}
+		return Count;
+	}
+
+#if SAL_SCORE_SSE2
+	// SSE2 has no 32-bit integer min/max (that is SSE4.1), so select through a compare mask.
+	FORCEINLINE __m128i MinEpi32(__m128i A, __m128i B)
+	{
+		const __m128i Mask = _mm_cmplt_epi32(A, B);
+		return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B));
+	}
+
+	FORCEINLINE __m128i MaxEpi32(__m128i A, __m128i B)
+	{
+		const __m128i Mask = _mm_cmpgt_epi32(A, B);
+		return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B));
+	}
+
+	FORCEINLINE int32 HorizontalSum(__m128i V)
+	{
+		alignas(16) int32 Lanes[4];
+		_mm_store_si128(reinterpret_cast<__m128i*>(Lanes), V);
+		return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+	}
+
+	static FSummary SummarizeSSE2(const int32* Data, int32 Num)
+	{
+		__m128i VMin = _mm_set1_epi32(MAX_int32);
+		__m128i VMax = _mm_set1_epi32(MIN_int32);
+
+		// Sum in doubles: exact for any int32 column below 2^21 rows, and it cannot overflow.
+		__m128d SumLow = _mm_setzero_pd();
+		__m128d SumHigh = _mm_setzero_pd();
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const __m128i V = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + i));
+			VMin = MinEpi32(VMin, V);
+			VMax = MaxEpi32(VMax, V);
+			SumLow = _mm_add_pd(SumLow, _mm_cvtepi32_pd(V));
+			SumHigh = _mm_add_pd(SumHigh, _mm_cvtepi32_pd(_mm_shuffle_epi32(V, _MM_SHUFFLE(1, 0, 3, 2))));
+		}
+
+		alignas(16) int32 MinLanes[4];
+		alignas(16) int32 MaxLanes[4];
+		alignas(16) double SumLanes[2];
+		_mm_store_si128(reinterpret_cast<__m128i*>(MinLanes), VMin);
+		_mm_store_si128(reinterpret_cast<__m128i*>(MaxLanes), VMax);
+		_mm_store_pd(SumLanes, _mm_add_pd(SumLow, SumHigh));
+
+		FSummary Summary = SummarizeScalar(Data + i, Num - i);
+		Summary.Count = Num;
+		Summary.Sum += SumLanes[0] + SumLanes[1];
+
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			Summary.Min = FMath::Min(Summary.Min, MinLanes[Lane]);
+			Summary.Max = FMath::Max(Summary.Max, MaxLanes[Lane]);
+		}
+
+		return Summary;
+	}
+
+	static void HistogramSSE2(const int32* Data, int32 Num, int32 Min, double Scale, int32 NumBuckets, int32* Counts)
+	{
+		// One sub-histogram per lane, so consecutive increments rarely hit the same counter.
+		TArray<int32> LaneCounts;
+		LaneCounts.SetNumZeroed(NumBuckets * 4);
+
+		const __m128d VMin = _mm_set1_pd(double(Min));
+		const __m128d VScale = _mm_set1_pd(Scale);
+		const __m128d VZero = _mm_setzero_pd();
+		const __m128d VLast = _mm_set1_pd(double(NumBuckets - 1));
+
+		alignas(16) int32 Buckets[4];
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const __m128i V = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + i));
+
+			__m128d Low = _mm_mul_pd(_mm_sub_pd(_mm_cvtepi32_pd(V), VMin), VScale);
+			__m128d High = _mm_mul_pd(_mm_sub_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(V, _MM_SHUFFLE(1, 0, 3, 2))), VMin), VScale);
+			Low = _mm_min_pd(_mm_max_pd(Low, VZero), VLast);
+			High = _mm_min_pd(_mm_max_pd(High, VZero), VLast);
+
+			_mm_store_si128(reinterpret_cast<__m128i*>(Buckets),
+			                _mm_unpacklo_epi64(_mm_cvttpd_epi32(Low), _mm_cvttpd_epi32(High)));
+
+			++LaneCounts[Buckets[0]];
+			++LaneCounts[NumBuckets + Buckets[1]];
+			++LaneCounts[NumBuckets * 2 + Buckets[2]];
+			++LaneCounts[NumBuckets * 3 + Buckets[3]];
+		}
+
+		HistogramScalar(Data + i, Num - i, Min, Scale, NumBuckets, Counts);
+
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			Counts[Bucket] += LaneCounts[Bucket] + LaneCounts[NumBuckets + Bucket]
+				+ LaneCounts[NumBuckets * 2 + Bucket] + LaneCounts[NumBuckets * 3 + Bucket];
+		}
+	}
+
+	static int32 CountBelowSSE2(const int32* Data, int32 Num, int32 Threshold)
+	{
+		const __m128i VThreshold = _mm_set1_epi32(Threshold);
+		__m128i Acc = _mm_setzero_si128();
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const __m128i V = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + i));
+			// A true compare is all ones (-1), so subtracting the mask counts matches.
+			Acc = _mm_sub_epi32(Acc, _mm_cmplt_epi32(V, VThreshold));
+		}
+
+		return HorizontalSum(Acc) + CountBelowScalar(Data + i, Num - i, Threshold);
+	}
+
+	static int32 CountAboveSSE2(const int32* Data, int32 Num, int32 Threshold)
+	{
+		const __m128i VThreshold = _mm_set1_epi32(Threshold);
+		__m128i Acc = _mm_setzero_si128();
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const __m128i V = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + i));
+			Acc = _mm_sub_epi32(Acc, _mm_cmpgt_epi32(V, VThreshold));
+		}
+
+		return HorizontalSum(Acc) + CountAboveScalar(Data + i, Num - i, Threshold);
+	}
+#endif
+}
+
+FSAL_ScoreAnalytics::FSummary FSAL_ScoreAnalytics::Summarize(TConstArrayView<int32> Scores)
+{
+	if (Scores.Num() == 0)
+	{
+		return FSummary();
+	}
+
+#if SAL_SCORE_SSE2
+	return SAL_ScoreKernels::SummarizeSSE2(Scores.GetData(), Scores.Num());
+#else
+	return SAL_ScoreKernels::SummarizeScalar(Scores.GetData(), Scores.Num());
+#endif
+}
+
+void FSAL_ScoreAnalytics::Histogram(TConstArrayView<int32> Scores, int32 Min, int32 Max, int32 NumBuckets, TArray<int32>& OutCounts)
+{
+	OutCounts.Reset();
+
+	if (NumBuckets <= 0)
+	{
+		return;
+	}
+
+	OutCounts.SetNumZeroed(NumBuckets);
+
+	if (Scores.Num() == 0 || Max < Min)
+	{
+		return;
+	}
+
+	const double Scale = double(NumBuckets) / (double(Max) - double(Min) + 1.0);
+
+#if SAL_SCORE_SSE2
+	SAL_ScoreKernels::HistogramSSE2(Scores.GetData(), Scores.Num(), Min, Scale, NumBuckets, OutCounts.GetData());
+#else
+	SAL_ScoreKernels::HistogramScalar(Scores.GetData(), Scores.Num(), Min, Scale, NumBuckets, OutCounts.GetData());
+#endif
+}
+
+int32 FSAL_ScoreAnalytics::CountBelow(TConstArrayView<int32> Scores, int32 Threshold)
+{
+#if SAL_SCORE_SSE2
+	return SAL_ScoreKernels::CountBelowSSE2(Scores.GetData(), Scores.Num(), Threshold);
+#else
+	return SAL_ScoreKernels::CountBelowScalar(Scores.GetData(), Scores.Num(), Threshold);
+#endif
+}
+
+int32 FSAL_ScoreAnalytics::CountAbove(TConstArrayView<int32> Scores, int32 Threshold)
+{
+#if SAL_SCORE_SSE2
+	return SAL_ScoreKernels::CountAboveSSE2(Scores.GetData(), Scores.Num(), Threshold);
+#else
+	return SAL_ScoreKernels::CountAboveScalar(Scores.GetData(), Scores.Num(), Threshold);
+#endif
+}
+
+bool FSAL_ScoreAnalytics::IsMonotonic(TConstArrayView<int32> Scores, bool& bOutAscending)
+{
+	bool bRises = false;
+	bool bFalls = false;
+
+	for (int32 i = 1; i < Scores.Num() && !(bRises && bFalls); ++i)
+	{
+		bRises |= Scores[i] > Scores[i - 1];
+		bFalls |= Scores[i] < Scores[i - 1];
+	}
+
+	bOutAscending = !bFalls;
+	return !(bRises && bFalls);
+}
+
+int32 FSAL_ScoreAnalytics::CountAhead(TConstArrayView<int32> Scores, int32 Score, ESALLeaderboardSortMethod SortMethod)
+{
+	const bool bDescending = SortMethod == ESALLeaderboardSortMethod::Descending;
+
+	bool bAscending = true;
+	if (!IsMonotonic(Scores, bAscending))
+	{
+		return bDescending
+			? Scores.Num() - CountBelow(Scores, Score)
+			: Scores.Num() - CountAbove(Scores, Score);
+	}
+
+	// Count of the leading run of entries that rank ahead of or tie with Score.
+	auto IsAhead = [bDescending, Score](int32 Existing)
+	{
+		return bDescending ? Existing >= Score : Existing <= Score;
+	};
+
+	// A column in the board's rank order has its "ahead" entries first; otherwise they are last.
+	const bool bRankOrder = bAscending != bDescending;
+
+	int32 Low = 0;
+	int32 High = Scores.Num();
+
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+
+		if (IsAhead(Scores[Mid]) == bRankOrder)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	return bRankOrder ? Low : Scores.Num() - Low;
+}
+
+void FSAL_ScoreAnalytics::Quantiles(TConstArrayView<int32> Scores, TConstArrayView<float> Fractions, TArray<int32>& OutScores)
+{
+	OutScores.Reset(Fractions.Num());
+
+	const int32 Num = Scores.Num();
+	if (Num == 0)
+	{
+		OutScores.SetNumZeroed(Fractions.Num());
+		return;
+	}
+
+	bool bAscending = true;
+	TArray<int32> Sorted;
+
+	if (!IsMonotonic(Scores, bAscending))
+	{
+		Sorted = TArray<int32>(Scores.GetData(), Num);
+		Sorted.Sort();
+		bAscending = true;
+	}
+
+	const TConstArrayView<int32> Ordered = Sorted.Num() > 0 ? TConstArrayView<int32>(Sorted) : Scores;
+
+	for (const float Fraction : Fractions)
+	{
+		const int32 K = FMath::Clamp(FMath::RoundToInt(FMath::Clamp(Fraction, 0.0f, 1.0f) * (Num - 1)), 0, Num - 1);
+		OutScores.Add(Ordered[bAscending ? K : Num - 1 - K]);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+FString FSAL_ScoreAnalytics::RunBenchmark(int32 NumRows, int32 Iterations)
+{
+	NumRows = FMath::Max(NumRows, 1);
+	Iterations = FMath::Max(Iterations, 1);
+
+	FRandomStream Random(0x5A15);
+	TArray<int32> Scores;
+	Scores.SetNumUninitialized(NumRows);
+	for (int32& Score : Scores)
+	{
+		Score = Random.RandRange(-1000000, 1000000);
+	}
+
+	constexpr int32 NumBuckets = 32;
+	const FSummary Reference = SAL_ScoreKernels::SummarizeScalar(Scores.GetData(), NumRows);
+	const double Scale = double(NumBuckets) / (double(Reference.Max) - double(Reference.Min) + 1.0);
+
+	TArray<int32> Counts;
+	Counts.SetNumZeroed(NumBuckets);
+
+	// Accumulated so the optimizer cannot drop the timed loops.
+	int64 Sink = 0;
+
+	auto Time = [Iterations, &Sink](TFunctionRef<int64()> Kernel)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Sink += Kernel();
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+	};
+
+	const double ScalarSummary = Time([&]() { return int64(SAL_ScoreKernels::SummarizeScalar(Scores.GetData(), NumRows).Max); });
+	const double ScalarHistogram = Time([&]()
+	{
+		FMemory::Memzero(Counts.GetData(), NumBuckets * sizeof(int32));
+		SAL_ScoreKernels::HistogramScalar(Scores.GetData(), NumRows, Reference.Min, Scale, NumBuckets, Counts.GetData());
+		return int64(Counts[0]);
+	});
+	const double ScalarCount = Time([&]() { return int64(SAL_ScoreKernels::CountBelowScalar(Scores.GetData(), NumRows, 0)); });
+
+	const double VectorSummary = Time([&]() { return int64(Summarize(Scores).Max); });
+	const double VectorHistogram = Time([&]()
+	{
+		Histogram(Scores, Reference.Min, Reference.Max, NumBuckets, Counts);
+		return int64(Counts[0]);
+	});
+	const double VectorCount = Time([&]() { return int64(CountBelow(Scores, 0)); });
+
+	TArray<int32> ReferenceCounts;
+	ReferenceCounts.SetNumZeroed(NumBuckets);
+	SAL_ScoreKernels::HistogramScalar(Scores.GetData(), NumRows, Reference.Min, Scale, NumBuckets, ReferenceCounts.GetData());
+	Histogram(Scores, Reference.Min, Reference.Max, NumBuckets, Counts);
+
+	const FSummary Vector = Summarize(Scores);
+	const bool bMatches = Vector.Min == Reference.Min && Vector.Max == Reference.Max && Vector.Sum == Reference.Sum
+		&& Counts == ReferenceCounts
+		&& CountBelow(Scores, 0) == SAL_ScoreKernels::CountBelowScalar(Scores.GetData(), NumRows, 0);
+
+	const FString Report = FString::Printf(
+		TEXT("%s, %d rows x %d: Summarize %.3f/%.3f ms, Histogram %.3f/%.3f ms, CountBelow %.3f/%.3f ms (scalar/vector)%s"),
+		SAL_SCORE_SSE2 ? TEXT("SSE2") : TEXT("scalar only"), NumRows, Iterations,
+		ScalarSummary, VectorSummary, ScalarHistogram, VectorHistogram, ScalarCount, VectorCount,
+		bMatches ? TEXT("") : TEXT(" MISMATCH"));
+
+	UE_LOG(LogTemp, Log, TEXT("[SAL] ScoreAnalytics benchmark: %s (sink %lld)"), *Report, Sink);
+	return Report;
+}
+
+static FAutoConsoleCommand GSAL_BenchmarkScoreAnalyticsCommand(
+	TEXT("SAL.BenchmarkScoreAnalytics"),
+	TEXT("Times the score analytics kernels against scalar loops and checks their results. Args: [NumRows=100000] [Iterations=20]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumRows = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100000;
+		const int32 Iterations = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 20;
+
+		FSAL_ScoreAnalytics::RunBenchmark(FMath::Min(NumRows, 10000000), FMath::Min(Iterations, 1000));
+	}));
+#endif
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_ScoreAnalyticsLibrary.h"
+#include "SAL_LeaderboardEntryStore.h"
+#include "SAL_ScoreAnalytics.h"
+
+FSAL_ScoreStats USAL_ScoreAnalyticsLibrary::GetScoreStats(const FSAL_LeaderboardEntriesData& EntriesData)
+{
+	const FSAL_LeaderboardEntryStorePtr Store = EntriesData.GetOrBuildStore();
+	const FSAL_ScoreAnalytics::FSummary Summary = FSAL_ScoreAnalytics::Summarize(Store->GetScoreColumn());
+
+	FSAL_ScoreStats Stats;
+	Stats.Count = Summary.Count;
+	Stats.MinScore = Summary.Min;
+	Stats.MaxScore = Summary.Max;
+	Stats.MeanScore = static_cast<float>(Summary.GetMean());
+	return Stats;
+}
+
+void USAL_ScoreAnalyticsLibrary::GetScoreHistogram(const FSAL_LeaderboardEntriesData& EntriesData, int32 NumBuckets,
+                                                   TArray<int32>& Counts, int32& MinScore, int32& MaxScore)
+{
+	const FSAL_LeaderboardEntryStorePtr Store = EntriesData.GetOrBuildStore();
+	const FSAL_ScoreAnalytics::FSummary Summary = FSAL_ScoreAnalytics::Summarize(Store->GetScoreColumn());
+
+	MinScore = Summary.Min;
+	MaxScore = Summary.Max;
+	FSAL_ScoreAnalytics::Histogram(Store->GetScoreColumn(), Summary.Min, Summary.Max, FMath::Clamp(NumBuckets, 1, 4096), Counts);
+}
+
+void USAL_ScoreAnalyticsLibrary::GetScoreQuantiles(const FSAL_LeaderboardEntriesData& EntriesData,
+                                                   const TArray<float>& Fractions, TArray<int32>& Scores)
+{
+	const FSAL_LeaderboardEntryStorePtr Store = EntriesData.GetOrBuildStore();
+	FSAL_ScoreAnalytics::Quantiles(Store->GetScoreColumn(), Fractions, Scores);
+}
+
+float USAL_ScoreAnalyticsLibrary::GetTopPercentForScore(const FSAL_LeaderboardEntriesData& EntriesData, int32 Score,
+                                                        ESALLeaderboardSortMethod SortMethod, int32& NumAhead)
+{
+	const FSAL_LeaderboardEntryStorePtr Store = EntriesData.GetOrBuildStore();
+
+	NumAhead = FSAL_ScoreAnalytics::CountAhead(Store->GetScoreColumn(), Score, SortMethod);
+	return Store->Num() > 0 ? 100.0f * NumAhead / Store->Num() : 0.0f;
+}
@@ -0,0 +1,254 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_ScoreRankIndex.h"
+#include "SAL_LeaderboardEntryStore.h"
+
+int32 FSAL_ScoreRankIndex::FindInsertIndex(int32 Score) const
+{
+	int32 Low = 0;
+	int32 High = Scores.Num();
+
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+
+		if (IsBetter(Score, Scores[Mid]))
+		{
+			High = Mid;
+		}
+		else
+		{
+			Low = Mid + 1;
+		}
+	}
+
+	return Low;
+}
+
+int32 FSAL_ScoreRankIndex::FindSteamID(uint64 SteamID) const
+{
+	if (SteamID == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	if (SteamID != LookupSteamID)
+	{
+		LookupSteamID = SteamID;
+		LookupIndex = SteamIDs.IndexOfByKey(SteamID);
+	}
+
+	return LookupIndex;
+}
+
+void FSAL_ScoreRankIndex::Insert(const FSAL_LeaderboardEntryStore& Rows)
+{
+	int32 MinRank = MAX_int32;
+	int32 MaxRank = 0;
+	TSet<uint64> Incoming;
+	Incoming.Reserve(Rows.Num());
+
+	for (int32 i = 0; i < Rows.Num(); ++i)
+	{
+		if (Rows.GetGlobalRank(i) > 0)
+		{
+			MinRank = FMath::Min(MinRank, Rows.GetGlobalRank(i));
+			MaxRank = FMath::Max(MaxRank, Rows.GetGlobalRank(i));
+			Incoming.Add(Rows.GetSteamID(i));
+		}
+	}
+
+	if (Incoming.Num() == 0)
+	{
+		return;
+	}
+
+	// Friends downloads are sparse: only replace the exact ranks they carry, not the span between them.
+	const bool bContiguous = (MaxRank - MinRank + 1) == Incoming.Num();
+
+	TArray<int32> NewRanks;
+	TArray<int32> NewScores;
+	TArray<uint64> NewSteamIDs;
+	const int32 Capacity = Ranks.Num() + Rows.Num();
+	NewRanks.Reserve(Capacity);
+	NewScores.Reserve(Capacity);
+	NewSteamIDs.Reserve(Capacity);
+
+	TSet<int32> IncomingRanks;
+	if (!bContiguous)
+	{
+		for (int32 i = 0; i < Rows.Num(); ++i)
+		{
+			IncomingRanks.Add(Rows.GetGlobalRank(i));
+		}
+	}
+
+	// Rows from Steam are sorted by rank; merge them with the surviving points.
+	int32 Old = 0;
+	int32 In = 0;
+
+	while (Old < Ranks.Num() || In < Rows.Num())
+	{
+		if (In < Rows.Num() && Rows.GetGlobalRank(In) <= 0)
+		{
+			++In;
+			continue;
+		}
+
+		if (Old < Ranks.Num())
+		{
+			const bool bReplaced = Incoming.Contains(SteamIDs[Old])
+				|| (bContiguous ? (Ranks[Old] >= MinRank && Ranks[Old] <= MaxRank) : IncomingRanks.Contains(Ranks[Old]));
+
+			if (bReplaced)
+			{
+				++Old;
+				continue;
+			}
+		}
+
+		const bool bTakeIncoming = In < Rows.Num() && (Old >= Ranks.Num() || Rows.GetGlobalRank(In) < Ranks[Old]);
+
+		if (bTakeIncoming)
+		{
+			NewRanks.Add(Rows.GetGlobalRank(In));
+			NewScores.Add(Rows.GetScore(In));
+			NewSteamIDs.Add(Rows.GetSteamID(In));
+			++In;
+		}
+		else
+		{
+			NewRanks.Add(Ranks[Old]);
+			NewScores.Add(Scores[Old]);
+			NewSteamIDs.Add(SteamIDs[Old]);
+			++Old;
+		}
+	}
+
+	Ranks = MoveTemp(NewRanks);
+	Scores = MoveTemp(NewScores);
+	SteamIDs = MoveTemp(NewSteamIDs);
+	LookupSteamID = 0;
+}
+
+void FSAL_ScoreRankIndex::RemoveAt(int32 Index)
+{
+	Ranks.RemoveAt(Index);
+	Scores.RemoveAt(Index);
+	SteamIDs.RemoveAt(Index);
+	LookupSteamID = 0;
+}
+
+void FSAL_ScoreRankIndex::ApplyUpload(uint64 SteamID, int32 Score, int32 NewRank)
+{
+	if (NewRank <= 0)
+	{
+		return;
+	}
+
+	const int32 OldIndex = FindSteamID(SteamID);
+	if (OldIndex != INDEX_NONE)
+	{
+		const int32 OldRank = Ranks[OldIndex];
+		RemoveAt(OldIndex);
+
+		for (int32 i = OldIndex; i < Ranks.Num(); ++i)
+		{
+			if (Ranks[i] > OldRank)
+			{
+				--Ranks[i];
+			}
+		}
+	}
+
+	int32 InsertIndex = 0;
+	while (InsertIndex < Ranks.Num() && Ranks[InsertIndex] < NewRank)
+	{
+		++InsertIndex;
+	}
+
+	for (int32 i = InsertIndex; i < Ranks.Num(); ++i)
+	{
+		++Ranks[i];
+	}
+
+	Ranks.Insert(NewRank, InsertIndex);
+	Scores.Insert(Score, InsertIndex);
+	SteamIDs.Insert(SteamID, InsertIndex);
+
+	// Uploads are the local user's, whose point the next prediction excludes.
+	LookupSteamID = SteamID;
+	LookupIndex = InsertIndex;
+}
+
+bool FSAL_ScoreRankIndex::PredictRank(int32 Score, int32 TotalEntries, uint64 ExcludeSteamID, FPrediction& Out) const
+{
+	Out = FPrediction();
+
+	if (Ranks.Num() == 0)
+	{
+		return false;
+	}
+
+	const int32 Index = FindInsertIndex(Score);
+
+	// The excluded user's current entry disappears when the new score replaces it: skip it as a neighbour,
+	// and pull every cached rank behind it up by one.
+	const int32 ExcludedIndex = FindSteamID(ExcludeSteamID);
+	const int32 ExcludedRank = ExcludedIndex != INDEX_NONE ? Ranks[ExcludedIndex] : MAX_int32;
+
+	auto RankAt = [this, ExcludedRank](int32 i)
+	{
+		return Ranks[i] > ExcludedRank ? Ranks[i] - 1 : Ranks[i];
+	};
+
+	int32 AboveIndex = Index - 1;
+	if (AboveIndex >= 0 && AboveIndex == ExcludedIndex)
+	{
+		--AboveIndex;
+	}
+
+	int32 BelowIndex = Index;
+	if (BelowIndex < Ranks.Num() && BelowIndex == ExcludedIndex)
+	{
+		++BelowIndex;
+	}
+
+	const bool bHasAbove = AboveIndex >= 0;
+	const bool bHasBelow = BelowIndex < Ranks.Num();
+	const int32 LastRank = FMath::Max(ExcludedIndex != INDEX_NONE ? TotalEntries - 1 : TotalEntries, RankAt(Ranks.Num() - 1));
+
+	const int32 AboveRank = bHasAbove ? RankAt(AboveIndex) : 0;
+	const int32 BelowRank = bHasBelow ? RankAt(BelowIndex) : LastRank + 1;
+
+	Out.BestRank = AboveRank + 1;
+	Out.WorstRank = FMath::Max(BelowRank, Out.BestRank);
+
+	if (bHasAbove && bHasBelow && BelowRank > AboveRank + 1 && Scores[AboveIndex] != Scores[BelowIndex])
+	{
+		// Interpolate on score between the two cached neighbours.
+		const double T = double(Scores[AboveIndex] - Score) / double(Scores[AboveIndex] - Scores[BelowIndex]);
+		Out.Rank = FMath::Clamp(AboveRank + 1 + FMath::RoundToInt(T * (BelowRank - AboveRank - 1)),
+		                        Out.BestRank, Out.WorstRank);
+	}
+	else
+	{
+		// With only one known side, the nearest possible rank is the best guess.
+		Out.Rank = bHasAbove ? Out.BestRank : Out.WorstRank;
+	}
+
+	Out.bExact = Out.BestRank == Out.WorstRank;
+	return true;
+}
+
+void FSAL_ScoreRankIndex::GetAdjacent(int32 Score, int32 NumAbove, int32 NumBelow, TArray<int32>& OutIndices) const
+{
+	const int32 Index = FindInsertIndex(Score);
+	const int32 First = FMath::Max(Index - FMath::Max(NumAbove, 0), 0);
+	const int32 Last = FMath::Min(Index + FMath::Max(NumBelow, 0), Ranks.Num());
+
+	for (int32 i = First; i < Last; ++i)
+	{
+		OutIndices.Add(i);
+	}
+}
@@ -0,0 +1,889 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_UploadJournalSubsystem.h"
+#include "SAL_Internal.h"
+#include "SAL_LeaderboardRegistrySubsystem.h"
+#include "SteamSALBlueprintLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace SAL_Journal
+{
+	// File: 'SALJ' magic and version, then frames of [uint32 length][uint32 CRC32][payload].
+	static constexpr uint32 Magic = 0x4A4C4153;
+	static constexpr uint32 Version = 1;
+	static constexpr int32 HeaderSize = 8;
+
+	enum class ERecord : uint8
+	{
+		Add = 1,
+		Ack = 2,
+	};
+
+	// Acks appended before the file is rewritten with only the pending entries.
+	static constexpr int32 CompactAfterAcks = 32;
+
+	static void AppendFrame(TArray<uint8>& Out, const TArray<uint8>& Payload)
+	{
+		uint32 Length = Payload.Num();
+		uint32 Crc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+
+		FMemoryWriter Writer(Out, false, true);
+		Writer.Seek(Out.Num());
+		Writer << Length;
+		Writer << Crc;
+		Out.Append(Payload);
+	}
+
+	static TArray<uint8> MakeHeader()
+	{
+		TArray<uint8> Header;
+		FMemoryWriter Writer(Header);
+		uint32 HeaderMagic = Magic;
+		uint32 HeaderVersion = Version;
+		Writer << HeaderMagic;
+		Writer << HeaderVersion;
+		return Header;
+	}
+}
+
+USAL_UploadJournalSubsystem* USAL_UploadJournalSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine
+		? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull)
+		: nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<USAL_UploadJournalSubsystem>() : nullptr;
+}
+
+void USAL_UploadJournalSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Collection.InitializeDependency(USAL_LeaderboardRegistrySubsystem::StaticClass());
+
+	Super::Initialize(Collection);
+
+	// Steam may not be up yet; Tick retries until the journal of the signed-in user is loaded.
+	EnsureLoadedForCurrentUser();
+
+	ServersConnectedCallback.Register(this, &USAL_UploadJournalSubsystem::OnServersConnected);
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USAL_UploadJournalSubsystem::Tick));
+}
+
+void USAL_UploadJournalSubsystem::Deinitialize()
+{
+	ServersConnectedCallback.Unregister();
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
+	Fsync();
+	Journal.Reset();
+
+	// Unfinished replays stay in the journal and are retried next session.
+	Replays.Empty();
+	ReplayQueue.Empty();
+	Entries.Empty();
+	LoadedDir.Reset();
+
+	Super::Deinitialize();
+}
+
+void USAL_UploadJournalSubsystem::SerializeEntry(FArchive& Ar, FEntry& Entry)
+{
+	uint8 Method = static_cast<uint8>(Entry.Method);
+
+	Ar << Entry.Id;
+	Ar << Entry.LeaderboardName;
+	Ar << Entry.Score;
+	Ar << Method;
+	Ar << Entry.Details;
+	Ar << Entry.UGCFileName;
+	Ar << Entry.UGCPayloadPath;
+
+	Entry.Method = static_cast<ESALLeaderboardUploadMethod>(Method);
+}
+
+FString USAL_UploadJournalSubsystem::GetJournalDir() const
+{
+	if (SteamUtils() == nullptr || SteamUser() == nullptr)
+	{
+		return FString();
+	}
+
+	// One journal per Steam account, so another account on this PC never replays these scores.
+	return FPaths::ProjectSavedDir() / TEXT("SteamSAL") / TEXT("Journal") / LexToString(SteamUtils()->GetAppID())
+		/ LexToString(SteamUser()->GetSteamID().ConvertToUint64());
+}
+
+bool USAL_UploadJournalSubsystem::EnsureLoadedForCurrentUser()
+{
+	const FString Dir = GetJournalDir();
+	if (Dir.IsEmpty())
+	{
+		return false;
+	}
+
+	if (Dir == LoadedDir)
+	{
+		return true;
+	}
+
+	if (!LoadedDir.IsEmpty())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[SAL] UploadJournal: signed-in user changed, switching journals"));
+
+		Fsync();
+		Journal.Reset();
+
+		Replays.Empty();
+		ReplayQueue.Empty();
+		Entries.Empty();
+		NextId = 1;
+		NumAcksSinceCompaction = 0;
+	}
+
+	LoadedDir = Dir;
+	bStartupReplayDone = false;
+	Load();
+	return true;
+}
+
+void USAL_UploadJournalSubsystem::Load()
+{
+	const FString& Dir = LoadedDir;
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *(Dir / TEXT("Uploads.salj")), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+
+	if (Reader.IsError() || Magic != SAL_Journal::Magic || Version != SAL_Journal::Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: unrecognized journal ignored"));
+		return;
+	}
+
+	bool bTorn = false;
+	int32 NumAcks = 0;
+	int64 Offset = SAL_Journal::HeaderSize;
+
+	while (Offset < Bytes.Num())
+	{
+		if (Offset + 8 > Bytes.Num())
+		{
+			bTorn = true;
+			break;
+		}
+
+		uint32 Length = 0;
+		uint32 Crc = 0;
+		Reader.Seek(Offset);
+		Reader << Length;
+		Reader << Crc;
+
+		if (Offset + 8 + Length > Bytes.Num() || FCrc::MemCrc32(Bytes.GetData() + Offset + 8, Length) != Crc || Length == 0)
+		{
+			bTorn = true;
+			break;
+		}
+
+		const TArray<uint8> Payload(Bytes.GetData() + Offset + 8, Length);
+		Offset += 8 + Length;
+
+		FMemoryReader Record(Payload);
+		uint8 Type = 0;
+		Record << Type;
+
+		if (Type == static_cast<uint8>(SAL_Journal::ERecord::Add))
+		{
+			FEntry Entry;
+			SerializeEntry(Record, Entry);
+
+			if (!Record.IsError())
+			{
+				NextId = FMath::Max(NextId, Entry.Id + 1);
+				Entries.Add(MoveTemp(Entry));
+			}
+		}
+		else if (Type == static_cast<uint8>(SAL_Journal::ERecord::Ack))
+		{
+			uint32 Id = 0;
+			Record << Id;
+			Entries.RemoveAll([Id](const FEntry& Entry) { return Entry.Id == Id; });
+			++NumAcks;
+		}
+	}
+
+	if (bTorn)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: ignoring torn tail at byte %lld (crash during a write?)"), Offset);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[SAL] UploadJournal: %d pending upload(s) loaded"), Entries.Num());
+
+	// Rewrite without the acks and any torn tail, so appends continue from a clean frame boundary.
+	if (bTorn || NumAcks > 0)
+	{
+		Compact();
+	}
+}
+
+bool USAL_UploadJournalSubsystem::OpenJournal()
+{
+	if (Journal.IsValid())
+	{
+		return true;
+	}
+
+	const FString& Dir = LoadedDir;
+	if (Dir.IsEmpty())
+	{
+		return false;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*Dir);
+
+	const FString Path = Dir / TEXT("Uploads.salj");
+	const bool bNew = PlatformFile.FileSize(*Path) <= 0;
+
+	Journal.Reset(PlatformFile.OpenWrite(*Path, true, false));
+	if (!Journal.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: cannot open '%s'"), *Path);
+		return false;
+	}
+
+	if (bNew)
+	{
+		const TArray<uint8> Header = SAL_Journal::MakeHeader();
+		if (!Journal->Write(Header.GetData(), Header.Num()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: cannot write header to '%s'"), *Path);
+			Journal.Reset();
+			return false;
+		}
+
+		bNeedsFsync = true;
+	}
+
+	return true;
+}
+
+bool USAL_UploadJournalSubsystem::AppendRecord(const TArray<uint8>& Payload)
+{
+	if (!OpenJournal())
+	{
+		return false;
+	}
+
+	TArray<uint8> Frame;
+	SAL_Journal::AppendFrame(Frame, Payload);
+
+	// One buffered write; the fsync is batched in Tick.
+	if (!Journal->Write(Frame.GetData(), Frame.Num()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: write failed"));
+
+		// Reopen on the next append; a partial frame is dropped as a torn tail on load.
+		Journal.Reset();
+		return false;
+	}
+
+	bNeedsFsync = true;
+	return true;
+}
+
+void USAL_UploadJournalSubsystem::Compact()
+{
+	Journal.Reset();
+	bNeedsFsync = false;
+	NumAcksSinceCompaction = 0;
+
+	if (LoadedDir.IsEmpty())
+	{
+		return;
+	}
+
+	const FString Path = LoadedDir / TEXT("Uploads.salj");
+
+	if (Entries.Num() == 0)
+	{
+		IFileManager::Get().Delete(*Path, false, true, true);
+		return;
+	}
+
+	TArray<uint8> Bytes = SAL_Journal::MakeHeader();
+
+	for (FEntry& Entry : Entries)
+	{
+		TArray<uint8> Payload;
+		FMemoryWriter Writer(Payload);
+		uint8 Type = static_cast<uint8>(SAL_Journal::ERecord::Add);
+		Writer << Type;
+		SerializeEntry(Writer, Entry);
+
+		SAL_Journal::AppendFrame(Bytes, Payload);
+	}
+
+	const FString TempPath = Path + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: compaction failed, keeping the old journal"));
+		IFileManager::Get().Delete(*TempPath, false, true, true);
+	}
+}
+
+bool USAL_UploadJournalSubsystem::JournalUpload(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score,
+                                                ESALLeaderboardUploadMethod UploadMethod, const TArray<int32>& Details,
+                                                const FString& UGCFileName, const TArray<uint8>& UGCData)
+{
+	check(IsInGameThread());
+
+	if (!EnsureLoadedForCurrentUser())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: no signed-in Steam user, upload not journaled"));
+		return false;
+	}
+
+	FString LeaderboardName;
+
+	if (USAL_LeaderboardRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<USAL_LeaderboardRegistrySubsystem>())
+	{
+		for (const FSAL_LeaderboardInfo& Info : Registry->GetAllKnown())
+		{
+			if (Info.LeaderboardHandle.Value == LeaderboardHandle.Value)
+			{
+				LeaderboardName = Info.LeaderboardName;
+				break;
+			}
+		}
+	}
+
+	if (LeaderboardName.IsEmpty())
+	{
+		LeaderboardName = USteamSALBlueprintLibrary::GetLeaderboardName(LeaderboardHandle);
+	}
+
+	if (LeaderboardName.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: unknown name for handle %lld, upload not journaled"),
+		       LeaderboardHandle.Value);
+		return false;
+	}
+
+	FEntry Entry;
+	Entry.Id = NextId++;
+	Entry.LeaderboardName = LeaderboardName;
+	Entry.Score = Score;
+	Entry.Method = UploadMethod;
+	Entry.Details = Details;
+
+	// Buffered like the record itself; the handle stays open until the next batched fsync.
+	TUniquePtr<IFileHandle> PayloadFile;
+
+	if (UGCData.Num() > 0)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.CreateDirectoryTree(*LoadedDir);
+
+		const FString PayloadPath = LoadedDir / FString::Printf(TEXT("UGC_%u.bin"), Entry.Id);
+		PayloadFile.Reset(PlatformFile.OpenWrite(*PayloadPath, false, true));
+
+		if (PayloadFile.IsValid() && PayloadFile->Write(UGCData.GetData(), UGCData.Num()) && PayloadFile->Flush(false))
+		{
+			Entry.UGCFileName = UGCFileName;
+			Entry.UGCPayloadPath = PayloadPath;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: UGC payload not saved; the score is journaled without it"));
+
+			if (PayloadFile.IsValid())
+			{
+				PayloadFile.Reset();
+				IFileManager::Get().Delete(*PayloadPath, false, true, true);
+			}
+		}
+	}
+
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+	uint8 Type = static_cast<uint8>(SAL_Journal::ERecord::Add);
+	Writer << Type;
+	SerializeEntry(Writer, Entry);
+
+	if (!AppendRecord(Payload))
+	{
+		if (!Entry.UGCPayloadPath.IsEmpty())
+		{
+			PayloadFile.Reset();
+			IFileManager::Get().Delete(*Entry.UGCPayloadPath, false, true, true);
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: score %d for '%s' could not be journaled"), Score, *LeaderboardName);
+		return false;
+	}
+
+	if (PayloadFile.IsValid())
+	{
+		UnsyncedPayloads.Add(Entry.Id, MoveTemp(PayloadFile));
+	}
+
+	Entries.Add(MoveTemp(Entry));
+
+	UE_LOG(LogTemp, Log, TEXT("[SAL] UploadJournal: journaled score %d for '%s' (%d pending)"),
+	       Score, *LeaderboardName, Entries.Num());
+	return true;
+}
+
+void USAL_UploadJournalSubsystem::OnServersConnected(SteamServersConnected_t* Connected)
+{
+	TWeakObjectPtr<USAL_UploadJournalSubsystem> Self(this);
+
+	SAL_RunOnGameThread([Self]()
+	{
+		if (!Self.IsValid()) return;
+		Self->ReplayNow();
+	});
+}
+
+bool USAL_UploadJournalSubsystem::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	if ((bNeedsFsync || UnsyncedPayloads.Num() > 0) && Now >= NextFsyncAt)
+	{
+		Fsync();
+		NextFsyncAt = Now + FMath::Max(FsyncIntervalSeconds, 0.0f);
+	}
+
+	if (LoadedDir.IsEmpty())
+	{
+		EnsureLoadedForCurrentUser();
+	}
+
+	if (!bStartupReplayDone && !LoadedDir.IsEmpty() && SteamUserStats() != nullptr)
+	{
+		bStartupReplayDone = true;
+		ReplayNow();
+	}
+
+	return true;
+}
+
+void USAL_UploadJournalSubsystem::Fsync()
+{
+	// Payloads first, so a record that reaches the disk does not point at a payload that did not.
+	for (TPair<uint32, TUniquePtr<IFileHandle>>& Pair : UnsyncedPayloads)
+	{
+		Pair.Value->Flush(true);
+	}
+
+	UnsyncedPayloads.Empty();
+
+	if (bNeedsFsync && Journal.IsValid())
+	{
+		Journal->Flush(true);
+	}
+
+	bNeedsFsync = false;
+}
+
+void USAL_UploadJournalSubsystem::ReplayNow()
+{
+	// Also switches to the journal of whoever is signed in now, so nobody replays another account's scores.
+	if (SteamUserStats() == nullptr || !EnsureLoadedForCurrentUser())
+	{
+		return;
+	}
+
+	for (const FEntry& Entry : Entries)
+	{
+		if (!Replays.Contains(Entry.Id))
+		{
+			ReplayQueue.AddUnique(Entry.Id);
+		}
+	}
+
+	StartNextReplays();
+}
+
+void USAL_UploadJournalSubsystem::StartNextReplays()
+{
+	// StartReplay can finish synchronously and call back in here; the outer loop picks up from there.
+	if (bStartingReplays)
+	{
+		return;
+	}
+
+	TGuardValue<bool> Guard(bStartingReplays, true);
+
+	bool bStarted = true;
+	while (bStarted && Replays.Num() < FMath::Max(MaxConcurrentReplays, 1))
+	{
+		bStarted = false;
+
+		// First queued entry whose board is idle. Uploads to one board run one at a time in journal order,
+		// so a newer ForceUpdate score is never overwritten by an older one.
+		for (int32 i = 0; i < ReplayQueue.Num(); ++i)
+		{
+			const uint32 Id = ReplayQueue[i];
+			const FEntry* Entry = Entries.FindByPredicate([Id](const FEntry& Candidate) { return Candidate.Id == Id; });
+
+			if (Entry == nullptr)
+			{
+				ReplayQueue.RemoveAt(i--);
+				continue;
+			}
+
+			if (IsBoardReplaying(Entry->LeaderboardName))
+			{
+				continue;
+			}
+
+			ReplayQueue.RemoveAt(i);
+			StartReplay(*Entry);
+			bStarted = true;
+			break;
+		}
+	}
+}
+
+bool USAL_UploadJournalSubsystem::IsBoardReplaying(const FString& LeaderboardName) const
+{
+	for (const TPair<uint32, TUniquePtr<FReplay>>& Pair : Replays)
+	{
+		if (Pair.Value->Entry.LeaderboardName == LeaderboardName)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void USAL_UploadJournalSubsystem::StartReplay(const FEntry& Entry)
+{
+	const uint32 Id = Entry.Id;
+
+	TUniquePtr<FReplay>& Replay = Replays.Add(Id, MakeUnique<FReplay>());
+	Replay->Entry = Entry;
+
+	USAL_LeaderboardRegistrySubsystem* Registry = GetGameInstance()->GetSubsystem<USAL_LeaderboardRegistrySubsystem>();
+	if (Registry == nullptr)
+	{
+		FinishReplay(Id, false, true, TEXT("Leaderboard registry not available."));
+		return;
+	}
+
+	TWeakObjectPtr<USAL_UploadJournalSubsystem> Self(this);
+
+	Registry->ResolveBoards({ Entry.LeaderboardName }, false,
+		[Self, Id](const TArray<FSAL_LeaderboardInfo>& Found, const TArray<FString>& Missing)
+		{
+			if (!Self.IsValid()) return;
+
+			TUniquePtr<FReplay>* Replay = Self->Replays.Find(Id);
+			if (Replay == nullptr) return;
+
+			if (Found.Num() == 0)
+			{
+				Self->FinishReplay(Id, false, true, TEXT("Leaderboard not found."));
+				return;
+			}
+
+			(*Replay)->Handle = Found[0].LeaderboardHandle;
+
+			if ((*Replay)->Entry.UGCPayloadPath.IsEmpty())
+			{
+				Self->ReplayUpload(Id);
+			}
+			else
+			{
+				Self->ReplayWrite(Id);
+			}
+		});
+}
+
+void USAL_UploadJournalSubsystem::ReplayWrite(uint32 Id)
+{
+	FReplay& Replay = *Replays.FindChecked(Id);
+
+	TArray<uint8> Payload;
+	if (!FFileHelper::LoadFileToArray(Payload, *Replay.Entry.UGCPayloadPath) || Payload.Num() == 0)
+	{
+		// The score still counts without its attachment.
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: UGC payload missing, replaying score only"));
+		Replay.Entry.UGCPayloadPath.Reset();
+		ReplayUpload(Id);
+		return;
+	}
+
+	if (SteamRemoteStorage() == nullptr)
+	{
+		FinishReplay(Id, false, true, TEXT("SteamRemoteStorage is not available."));
+		return;
+	}
+
+	// Steam copies the buffer before FileWriteAsync returns, so Payload may be released afterwards.
+	const FTCHARToUTF8 Utf8FileName(*Replay.Entry.UGCFileName);
+	const SteamAPICall_t ApiCall = SteamRemoteStorage()->FileWriteAsync(Utf8FileName.Get(), Payload.GetData(), Payload.Num());
+	if (ApiCall == k_uAPICallInvalid)
+	{
+		FinishReplay(Id, false, true, TEXT("FileWriteAsync returned an invalid API call handle."));
+		return;
+	}
+
+	TWeakObjectPtr<USAL_UploadJournalSubsystem> Self(this);
+
+	Replay.WriteCall.Set(ApiCall, [Self, Id](RemoteStorageFileWriteAsyncComplete_t* Result, bool bIOFailure)
+	{
+		const bool bOk = !bIOFailure && Result != nullptr && Result->m_eResult == k_EResultOK;
+
+		SAL_RunOnGameThread([Self, Id, bOk]()
+		{
+			if (!Self.IsValid() || !Self->Replays.Contains(Id)) return;
+
+			if (!bOk)
+			{
+				Self->FinishReplay(Id, false, true, TEXT("FileWriteAsync to Remote Storage failed."));
+				return;
+			}
+
+			Self->ReplayShare(Id);
+		});
+	});
+}
+
+void USAL_UploadJournalSubsystem::ReplayShare(uint32 Id)
+{
+	FReplay& Replay = *Replays.FindChecked(Id);
+
+	if (SteamRemoteStorage() == nullptr)
+	{
+		FinishReplay(Id, false, true, TEXT("SteamRemoteStorage is not available."));
+		return;
+	}
+
+	const FTCHARToUTF8 Utf8FileName(*Replay.Entry.UGCFileName);
+	const SteamAPICall_t ApiCall = SteamRemoteStorage()->FileShare(Utf8FileName.Get());
+	if (ApiCall == k_uAPICallInvalid)
+	{
+		FinishReplay(Id, false, true, TEXT("FileShare returned an invalid API call handle."));
+		return;
+	}
+
+	TWeakObjectPtr<USAL_UploadJournalSubsystem> Self(this);
+
+	Replay.ShareCall.Set(ApiCall, [Self, Id](RemoteStorageFileShareResult_t* Result, bool bIOFailure)
+	{
+		const bool bOk = !bIOFailure && Result != nullptr && Result->m_eResult == k_EResultOK;
+		const uint64 File = bOk ? Result->m_hFile : 0;
+
+		SAL_RunOnGameThread([Self, Id, bOk, File]()
+		{
+			if (!Self.IsValid()) return;
+
+			TUniquePtr<FReplay>* Replay = Self->Replays.Find(Id);
+			if (Replay == nullptr) return;
+
+			if (!bOk)
+			{
+				Self->FinishReplay(Id, false, true, TEXT("FileShare failed."));
+				return;
+			}
+
+			(*Replay)->UGCHandle.Value = static_cast<int64>(File);
+			Self->ReplayUpload(Id);
+		});
+	});
+}
+
+void USAL_UploadJournalSubsystem::ReplayUpload(uint32 Id)
+{
+	FReplay& Replay = *Replays.FindChecked(Id);
+
+	if (SteamUserStats() == nullptr)
+	{
+		FinishReplay(Id, false, true, TEXT("SteamUserStats is not available."));
+		return;
+	}
+
+	const int32 DetailsCount = FMath::Clamp(Replay.Entry.Details.Num(), 0, 64);
+
+	const SteamAPICall_t ApiCall = SteamUserStats()->UploadLeaderboardScore(
+		static_cast<SteamLeaderboard_t>(Replay.Handle.Value),
+		Replay.Entry.Method == ESALLeaderboardUploadMethod::ForceUpdate
+			? k_ELeaderboardUploadScoreMethodForceUpdate
+			: k_ELeaderboardUploadScoreMethodKeepBest,
+		Replay.Entry.Score,
+		DetailsCount > 0 ? Replay.Entry.Details.GetData() : nullptr,
+		DetailsCount);
+
+	if (ApiCall == k_uAPICallInvalid)
+	{
+		FinishReplay(Id, false, true, TEXT("UploadLeaderboardScore returned an invalid API call handle."));
+		return;
+	}
+
+	TWeakObjectPtr<USAL_UploadJournalSubsystem> Self(this);
+
+	Replay.UploadCall.Set(ApiCall, [Self, Id](LeaderboardScoreUploaded_t* Result, bool bIOFailure)
+	{
+		const bool bIOError = bIOFailure || Result == nullptr;
+		const bool bOk = !bIOError && Result->m_bSuccess != 0;
+
+		SAL_RunOnGameThread([Self, Id, bOk, bIOError]()
+		{
+			if (!Self.IsValid()) return;
+
+			TUniquePtr<FReplay>* Replay = Self->Replays.Find(Id);
+			if (Replay == nullptr) return;
+
+			if (bIOError)
+			{
+				Self->FinishReplay(Id, false, true, TEXT("Upload IO failure."));
+				return;
+			}
+
+			if (!bOk)
+			{
+				// Only a rejection by Steam counts toward MaxReplayAttempts; transport failures are retried forever.
+				if (FEntry* Entry = Self->Entries.FindByPredicate([Id](const FEntry& Candidate) { return Candidate.Id == Id; }))
+				{
+					++Entry->Attempts;
+				}
+
+				Self->FinishReplay(Id, false, true, TEXT("UploadLeaderboardScore was rejected."));
+				return;
+			}
+
+			if ((*Replay)->UGCHandle.IsValid())
+			{
+				Self->ReplayAttach(Id);
+			}
+			else
+			{
+				Self->FinishReplay(Id, true, false, FString());
+			}
+		});
+	});
+}
+
+void USAL_UploadJournalSubsystem::ReplayAttach(uint32 Id)
+{
+	FReplay& Replay = *Replays.FindChecked(Id);
+
+	const SteamAPICall_t ApiCall = SteamUserStats() != nullptr
+		? SteamUserStats()->AttachLeaderboardUGC(static_cast<SteamLeaderboard_t>(Replay.Handle.Value),
+		                                         static_cast<UGCHandle_t>(Replay.UGCHandle.Value))
+		: k_uAPICallInvalid;
+
+	// The score is already on the board; a failed attach is reported but not retried, since that would re-upload it.
+	if (ApiCall == k_uAPICallInvalid)
+	{
+		FinishReplay(Id, false, false, TEXT("AttachLeaderboardUGC returned an invalid API call handle."));
+		return;
+	}
+
+	TWeakObjectPtr<USAL_UploadJournalSubsystem> Self(this);
+
+	Replay.AttachCall.Set(ApiCall, [Self, Id](LeaderboardUGCSet_t* Result, bool bIOFailure)
+	{
+		const bool bOk = !bIOFailure && Result != nullptr && Result->m_eResult == k_EResultOK;
+
+		SAL_RunOnGameThread([Self, Id, bOk]()
+		{
+			if (!Self.IsValid()) return;
+			Self->FinishReplay(Id, bOk, false, bOk ? FString() : TEXT("AttachLeaderboardUGC failed."));
+		});
+	});
+}
+
+void USAL_UploadJournalSubsystem::FinishReplay(uint32 Id, bool bOk, bool bRetry, const FString& Error)
+{
+	TUniquePtr<FReplay> Replay;
+	if (!Replays.RemoveAndCopyValue(Id, Replay))
+	{
+		return;
+	}
+
+	const FEntry* Entry = Entries.FindByPredicate([Id](const FEntry& Candidate) { return Candidate.Id == Id; });
+	const bool bGiveUp = !bOk && (!bRetry || Entry == nullptr || Entry->Attempts >= MaxReplayAttempts);
+
+	if (bOk || bGiveUp)
+	{
+		if (!bOk)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadJournal: dropping score %d for '%s' after %d attempt(s): %s"),
+			       Replay->Entry.Score, *Replay->Entry.LeaderboardName, Entry ? Entry->Attempts : 0, *Error);
+		}
+
+		Acknowledge(Id);
+		OnUploadReplayed.Broadcast(Replay->Entry.LeaderboardName, Replay->Entry.Score, bOk);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[SAL] UploadJournal: replay of '%s' failed, kept for later: %s"),
+		       *Replay->Entry.LeaderboardName, *Error);
+
+		// Later uploads to this board wait for the next replay, so they still go out after this one.
+		const FString& BoardName = Replay->Entry.LeaderboardName;
+		ReplayQueue.RemoveAll([this, &BoardName](uint32 QueuedId)
+		{
+			const FEntry* Queued = Entries.FindByPredicate([QueuedId](const FEntry& Candidate) { return Candidate.Id == QueuedId; });
+			return Queued != nullptr && Queued->LeaderboardName == BoardName;
+		});
+	}
+
+	StartNextReplays();
+}
+
+void USAL_UploadJournalSubsystem::Acknowledge(uint32 Id)
+{
+	const int32 Index = Entries.IndexOfByPredicate([Id](const FEntry& Entry) { return Entry.Id == Id; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (!Entries[Index].UGCPayloadPath.IsEmpty())
+	{
+		// Close a payload that was never fsynced first; it is deleted anyway.
+		UnsyncedPayloads.Remove(Id);
+		IFileManager::Get().Delete(*Entries[Index].UGCPayloadPath, false, true, true);
+	}
+
+	Entries.RemoveAt(Index);
+
+	TArray<uint8> Payload;
+	FMemoryWriter Writer(Payload);
+	uint8 Type = static_cast<uint8>(SAL_Journal::ERecord::Ack);
+	uint32 AckId = Id;
+	Writer << Type;
+	Writer << AckId;
+
+	AppendRecord(Payload);
+
+	if (++NumAcksSinceCompaction >= SAL_Journal::CompactAfterAcks || Entries.Num() == 0)
+	{
+		Compact();
+	}
+}
@@ -2,6 +2,10 @@
 
 
 #include "SAL_UploadScore.h"
+#include "SAL_Internal.h"
+#include "SAL_MyLeaderboardEntrySubsystem.h"
+#include "SAL_RankPredictionSubsystem.h"
+#include "SAL_UploadJournalSubsystem.h"
 
 USAL_UploadScore* USAL_UploadScore::UploadScore(UObject* WorldContextObject,
                                                 FSAL_LeaderboardHandle LeaderboardHandle,
@@ -35,8 +39,7 @@ void USAL_UploadScore::Activate()
 	if (SteamUserStats() == nullptr)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadScore: SteamUserStats not available"));
-		OnFailure.Broadcast(TEXT("Steam not available or not initialized."));
-		SetReadyToDestroy();
+		FailAndJournal(TEXT("Steam not available or not initialized."));
 		return;
 	}
 
@@ -59,8 +62,7 @@ void USAL_UploadScore::Activate()
 	if (Call == k_uAPICallInvalid)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[SAL] UploadScore: Steam returned invalid APICall"));
-		OnFailure.Broadcast(TEXT("Steam returned an invalid API call handle."));
-		SetReadyToDestroy();
+		FailAndJournal(TEXT("Steam returned an invalid API call handle."));
 		return;
 	}
 
@@ -75,8 +77,13 @@ void USAL_UploadScore::OnUploadCompleted(LeaderboardScoreUploaded_t* Result, boo
 	if (bIOFailure || Result == nullptr)
 	{
 		UE_LOG(LogTemp, Error, TEXT("[SAL] UploadScore: IO failure or null result"));
-		OnFailure.Broadcast(TEXT("Steam IO failure during UploadLeaderboardScore."));
-		SetReadyToDestroy();
+
+		TWeakObjectPtr<USAL_UploadScore> Self(this);
+		SAL_RunOnGameThread([Self]()
+		{
+			if (!Self.IsValid()) return;
+			Self->FailAndJournal(TEXT("Steam IO failure during UploadLeaderboardScore."));
+		});
 		return;
 	}
 
@@ -105,7 +112,39 @@ void USAL_UploadScore::OnUploadCompleted(LeaderboardScoreUploaded_t* Result, boo
 	       bScoreChanged ? TEXT("true") : TEXT("false"),
 	       NewGlobalRank, PreviousGlobalRank);
 
-	OnSuccess.Broadcast();
+	const TWeakObjectPtr<USAL_UploadScore> Self(this);
+	const int64 Handle = LeaderboardHandle.Value;
+	const uint64 SteamID = SteamUser() != nullptr ? SteamUser()->GetSteamID().ConvertToUint64() : 0;
+	const int32 UploadedScore = Result->m_nScore;
+
+	// Broadcast only after the own-entry and prediction caches took the result, so OnSuccess handlers read the new rank.
+	SAL_RunOnGameThread([Self, Handle, SteamID, UploadedScore, bScoreChanged, NewGlobalRank, PreviousGlobalRank]()
+	{
+		if (!Self.IsValid()) return;
+
+		if (USAL_MyLeaderboardEntrySubsystem* MyEntry = USAL_MyLeaderboardEntrySubsystem::Get(Self->WorldContextObject))
+		{
+			MyEntry->RecordUpload(Handle, UploadedScore, bScoreChanged, NewGlobalRank);
+		}
+
+		if (bScoreChanged && SteamID != 0)
+		{
+			if (USAL_RankPredictionSubsystem* Prediction = USAL_RankPredictionSubsystem::Get(Self->WorldContextObject))
+			{
+				Prediction->ApplyUpload(Handle, SteamID, UploadedScore, NewGlobalRank);
+			}
+		}
+
+		Self->OnSuccess.Broadcast(UploadedScore, bScoreChanged, NewGlobalRank, PreviousGlobalRank);
+		Self->SetReadyToDestroy();
+	});
+}
+
+void USAL_UploadScore::FailAndJournal(const FString& Why)
+{
+	USAL_UploadJournalSubsystem* Journal = USAL_UploadJournalSubsystem::Get(WorldContextObject);
+	const bool bQueued = Journal != nullptr && Journal->JournalUpload(LeaderboardHandle, Score, UploadMethod, InDetails);
 
+	OnFailure.Broadcast(bQueued ? Why + TEXT(" Queued for replay.") : Why);
 	SetReadyToDestroy();
 }
@@ -0,0 +1,192 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#include "SAL_UploadScoreToBoards.h"
+#include "SAL_Internal.h"
+#include "SAL_MyLeaderboardEntrySubsystem.h"
+#include "SAL_RankPredictionSubsystem.h"
+#include "SAL_UploadJournalSubsystem.h"
+
+USAL_UploadScoreToBoards* USAL_UploadScoreToBoards::UploadScoreToBoards(
+	UObject* WorldContextObject, const TArray<FSAL_LeaderboardHandle>& LeaderboardHandles,
+	int32 Score, ESALLeaderboardUploadMethod UploadMethod, const TArray<int32>& Details)
+{
+	USAL_UploadScoreToBoards* Node = NewObject<USAL_UploadScoreToBoards>();
+
+	Node->RegisterWithGameInstance(WorldContextObject);
+
+	Node->WorldContextObject = WorldContextObject;
+	Node->InScore            = Score;
+	Node->InUploadMethod     = UploadMethod;
+	Node->InDetails          = Details;
+
+	// Uploading twice to one board would only race with itself.
+	for (const FSAL_LeaderboardHandle& Handle : LeaderboardHandles)
+	{
+		if (!Node->InHandles.ContainsByPredicate([&Handle](const FSAL_LeaderboardHandle& Existing) { return Existing.Value == Handle.Value; }))
+		{
+			Node->InHandles.Add(Handle);
+		}
+	}
+
+	return Node;
+}
+
+void USAL_UploadScoreToBoards::Activate()
+{
+	if (InHandles.Num() == 0)
+	{
+		Fail(TEXT("[SAL] UploadScoreToBoards: Empty leaderboard list"));
+		return;
+	}
+
+	Results.SetNum(InHandles.Num());
+	Calls.SetNum(InHandles.Num());
+	NumPending = InHandles.Num();
+
+	for (int32 i = 0; i < InHandles.Num(); ++i)
+	{
+		Results[i].LeaderboardHandle = InHandles[i];
+		Results[i].Score = InScore;
+	}
+
+	for (int32 i = 0; i < InHandles.Num(); ++i)
+	{
+		IssueUpload(i);
+	}
+}
+
+void USAL_UploadScoreToBoards::IssueUpload(int32 BoardIndex)
+{
+	FSAL_UploadScoreResult Result = Results[BoardIndex];
+
+	if (InHandles[BoardIndex].Value == 0)
+	{
+		Result.Error = TEXT("Invalid LeaderboardHandle");
+		OnBoardDone(BoardIndex, Result, false);
+		return;
+	}
+
+	if (SteamUserStats() == nullptr)
+	{
+		Result.Error = TEXT("Steam not available or not initialized.");
+		OnBoardDone(BoardIndex, Result, true);
+		return;
+	}
+
+	const int32 DetailsCount = FMath::Clamp(InDetails.Num(), 0, 64);
+
+	const SteamAPICall_t ApiCall = SteamUserStats()->UploadLeaderboardScore(
+		static_cast<SteamLeaderboard_t>(InHandles[BoardIndex].Value),
+		InUploadMethod == ESALLeaderboardUploadMethod::ForceUpdate
+			? k_ELeaderboardUploadScoreMethodForceUpdate
+			: k_ELeaderboardUploadScoreMethodKeepBest,
+		InScore,
+		DetailsCount > 0 ? InDetails.GetData() : nullptr,
+		DetailsCount
+	);
+
+	if (ApiCall == k_uAPICallInvalid)
+	{
+		Result.Error = TEXT("Steam returned an invalid API call handle.");
+		OnBoardDone(BoardIndex, Result, true);
+		return;
+	}
+
+	TWeakObjectPtr<USAL_UploadScoreToBoards> Self(this);
+
+	Calls[BoardIndex] = MakeUnique<TSAL_PendingCall<LeaderboardScoreUploaded_t>>();
+	Calls[BoardIndex]->Set(ApiCall, [Self, BoardIndex, Result](LeaderboardScoreUploaded_t* Callback, bool bIOFailure) mutable
+	{
+		bool bJournal = false;
+
+		if (bIOFailure || Callback == nullptr)
+		{
+			Result.Error = TEXT("Steam IO failure during UploadLeaderboardScore.");
+			bJournal = true;
+		}
+		else if (Callback->m_bSuccess == 0)
+		{
+			Result.Error = TEXT("UploadLeaderboardScore failed.");
+		}
+		else
+		{
+			Result.bOk                = true;
+			Result.Score              = Callback->m_nScore;
+			Result.bScoreChanged      = Callback->m_bScoreChanged != 0;
+			Result.NewGlobalRank      = Callback->m_nGlobalRankNew;
+			Result.PreviousGlobalRank = Callback->m_nGlobalRankPrevious;
+		}
+
+		SAL_RunOnGameThread([Self, BoardIndex, Result, bJournal]()
+		{
+			if (!Self.IsValid()) return;
+			Self->OnBoardDone(BoardIndex, Result, bJournal);
+		});
+	});
+}
+
+void USAL_UploadScoreToBoards::OnBoardDone(int32 BoardIndex, const FSAL_UploadScoreResult& Result, bool bJournal)
+{
+	Results[BoardIndex] = Result;
+
+	if (Result.bOk)
+	{
+		if (USAL_MyLeaderboardEntrySubsystem* MyEntry = USAL_MyLeaderboardEntrySubsystem::Get(WorldContextObject))
+		{
+			MyEntry->RecordUpload(Result.LeaderboardHandle.Value, Result.Score, Result.bScoreChanged, Result.NewGlobalRank);
+		}
+
+		if (Result.bScoreChanged && SteamUser() != nullptr)
+		{
+			if (USAL_RankPredictionSubsystem* Prediction = USAL_RankPredictionSubsystem::Get(WorldContextObject))
+			{
+				Prediction->ApplyUpload(Result.LeaderboardHandle.Value, SteamUser()->GetSteamID().ConvertToUint64(),
+				                        Result.Score, Result.NewGlobalRank);
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SAL] UploadScoreToBoards: board %lld failed: %s"),
+		       Result.LeaderboardHandle.Value, *Result.Error);
+
+		USAL_UploadJournalSubsystem* Journal = bJournal ? USAL_UploadJournalSubsystem::Get(WorldContextObject) : nullptr;
+		if (Journal != nullptr && Journal->JournalUpload(Result.LeaderboardHandle, InScore, InUploadMethod, InDetails))
+		{
+			Results[BoardIndex].Error += TEXT(" Queued for replay.");
+		}
+	}
+
+	if (--NumPending == 0)
+	{
+		Finish();
+	}
+}
+
+void USAL_UploadScoreToBoards::Finish()
+{
+	Calls.Empty();
+
+	const int32 NumSucceeded = Results.FilterByPredicate([](const FSAL_UploadScoreResult& Result) { return Result.bOk; }).Num();
+
+	UE_LOG(LogTemp, Log, TEXT("[SAL] UploadScoreToBoards: %d of %d boards accepted score %d"),
+	       NumSucceeded, Results.Num(), InScore);
+
+	if (NumSucceeded == 0)
+	{
+		Fail(FString::Printf(TEXT("[SAL] UploadScoreToBoards: All %d boards failed (first error: %s)"),
+		                     Results.Num(), *Results[0].Error));
+		return;
+	}
+
+	OnSuccess.Broadcast(Results, NumSucceeded);
+	SetReadyToDestroy();
+}
+
+void USAL_UploadScoreToBoards::Fail(const FString& Why)
+{
+	Calls.Empty();
+
+	OnFailure.Broadcast(Why, Results);
+	SetReadyToDestroy();
+}
@@ -2,6 +2,8 @@
 
 #include "SAL_UploadScoreWithUGC.h"
 #include "SAL_Internal.h"
+#include "SAL_MyLeaderboardEntrySubsystem.h"
+#include "SAL_UploadJournalSubsystem.h"
 
 USAL_UploadScoreWithUGC* USAL_UploadScoreWithUGC::UploadScoreWithUGC(
 	UObject* WorldContextObject,
@@ -9,7 +11,9 @@ USAL_UploadScoreWithUGC* USAL_UploadScoreWithUGC::UploadScoreWithUGC(
 	int32 Score,
 	TArray<int32> Details,
 	FString UGCFileName,
-	TArray<uint8> UGCData)
+	TArray<uint8> UGCData,
+	ESALLeaderboardUploadMethod UploadMethod,
+	bool bScoreFirst)
 {
 	USAL_UploadScoreWithUGC* Node = NewObject<USAL_UploadScoreWithUGC>();
 
@@ -23,6 +27,8 @@ USAL_UploadScoreWithUGC* USAL_UploadScoreWithUGC::UploadScoreWithUGC(
 		Node->InDetails          = Details;
 		Node->InUGCFileName      = UGCFileName;
 		Node->InUGCData          = UGCData;
+		Node->InUploadMethod     = UploadMethod;
+		Node->bInScoreFirst      = bScoreFirst;
 	}
 
 	return Node;
@@ -58,24 +64,33 @@ void USAL_UploadScoreWithUGC::Activate()
 
 	if (SteamRemoteStorage() == nullptr)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: SteamRemoteStorage is not available."));
+		FailAndJournal(TEXT("[SteamSAL] UploadScoreWithUGC: SteamRemoteStorage is not available."));
 		return;
 	}
 
 	if (SteamUserStats() == nullptr)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: SteamUserStats is not available."));
+		FailAndJournal(TEXT("[SteamSAL] UploadScoreWithUGC: SteamUserStats is not available."));
 		return;
 	}
-	
-	const FTCHARToUTF8 Utf8FileName(*InUGCFileName);
-	
-	const bool bWriteOk = SteamRemoteStorage()->FileWrite(
-	Utf8FileName.Get(),
-	InUGCData.GetData(),
-	InUGCData.Num()
-);
-	
+
+	// In score-first mode the file is only written once the upload shows it will be used.
+	if (!bInScoreFirst)
+	{
+		StartFileWrite();
+	}
+
+	StartUploadScore();
+}
+
+void USAL_UploadScoreWithUGC::StartFileWrite()
+{
+	if (SteamRemoteStorage() == nullptr)
+	{
+		FailShare(TEXT("[SteamSAL] UploadScoreWithUGC: SteamRemoteStorage is not available for FileWriteAsync."));
+		return;
+	}
+
 	const bool bCloudAccount = SteamRemoteStorage()->IsCloudEnabledForAccount();
 	const bool bCloudApp     = SteamRemoteStorage()->IsCloudEnabledForApp();
 
@@ -102,21 +117,53 @@ void USAL_UploadScoreWithUGC::Activate()
 		   bGotQuota ? TEXT("true") : TEXT("false"),
 		   (unsigned long long)TotalBytes,
 		   (unsigned long long)AvailableBytes);
-	
-	if (!bWriteOk)
+
+	// Steam copies the buffer before FileWriteAsync returns, so InUGCData may be released afterwards.
+	const FTCHARToUTF8 Utf8FileName(*InUGCFileName);
+
+	SteamAPICall_t WriteCall = SteamRemoteStorage()->FileWriteAsync(
+		Utf8FileName.Get(),
+		InUGCData.GetData(),
+		static_cast<uint32>(InUGCData.Num())
+	);
+
+	if (WriteCall == k_uAPICallInvalid)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: FileWrite to Remote Storage failed."));
+		FailShare(TEXT("[SteamSAL] UploadScoreWithUGC: FileWriteAsync returned an invalid API call handle."));
 		return;
 	}
-	
-	StartFileShare();
+
+	// The score does not depend on the file; unless in score-first mode it is uploaded while this is in flight.
+	FileWriteCallResult.Set(WriteCall, this, &USAL_UploadScoreWithUGC::OnFileWritten);
+}
+
+void USAL_UploadScoreWithUGC::OnFileWritten(RemoteStorageFileWriteAsyncComplete_t* Callback, bool bIOFailure)
+{
+	const bool bOk = !bIOFailure && Callback != nullptr && Callback->m_eResult == k_EResultOK;
+	const int32 ResultCode = Callback != nullptr ? static_cast<int32>(Callback->m_eResult) : 0;
+
+	TWeakObjectPtr<USAL_UploadScoreWithUGC> Self(this);
+
+	SAL_RunOnGameThread([Self, bOk, ResultCode]()
+	{
+		if (!Self.IsValid() || Self->bFinished) return;
+
+		if (!bOk)
+		{
+			Self->FailShare(FString::Printf(
+				TEXT("[SteamSAL] UploadScoreWithUGC: FileWriteAsync to Remote Storage failed (result %d)."), ResultCode));
+			return;
+		}
+
+		Self->StartFileShare();
+	});
 }
 
 void USAL_UploadScoreWithUGC::StartFileShare()
 {
 	if (SteamRemoteStorage() == nullptr)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: SteamRemoteStorage is not available for FileShare."));
+		FailShare(TEXT("[SteamSAL] UploadScoreWithUGC: SteamRemoteStorage is not available for FileShare."));
 		return;
 	}
 
@@ -125,7 +172,7 @@ void USAL_UploadScoreWithUGC::StartFileShare()
 	SteamAPICall_t ApiCall = SteamRemoteStorage()->FileShare(Utf8FileName.Get());
 	if (ApiCall == k_uAPICallInvalid)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: FileShare returned an invalid API call handle."));
+		FailShare(TEXT("[SteamSAL] UploadScoreWithUGC: FileShare returned an invalid API call handle."));
 		return;
 	}
 
@@ -134,31 +181,48 @@ void USAL_UploadScoreWithUGC::StartFileShare()
 
 void USAL_UploadScoreWithUGC::OnFileShared(RemoteStorageFileShareResult_t* Callback, bool bIOFailure)
 {
+	FString Error;
+	uint64 File = 0;
+
 	if (bIOFailure || Callback == nullptr)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: FileShare IO failure."));
-		return;
+		Error = TEXT("[SteamSAL] UploadScoreWithUGC: FileShare IO failure.");
 	}
-
-	if (Callback->m_eResult != k_EResultOK)
+	else if (Callback->m_eResult != k_EResultOK)
 	{
-		const FString Reason = FString::Printf(
+		Error = FString::Printf(
 			TEXT("[SteamSAL] UploadScoreWithUGC: FileShare failed with result %d."),
 			static_cast<int32>(Callback->m_eResult)
 		);
-		Fail(Reason);
-		return;
 	}
-	
-	SharedUGCHandle.Value = static_cast<int64>(Callback->m_hFile);
-	StartUploadScore();
+	else
+	{
+		File = Callback->m_hFile;
+	}
+
+	TWeakObjectPtr<USAL_UploadScoreWithUGC> Self(this);
+
+	SAL_RunOnGameThread([Self, Error, File]()
+	{
+		if (!Self.IsValid() || Self->bFinished) return;
+
+		if (!Error.IsEmpty())
+		{
+			Self->FailShare(Error);
+			return;
+		}
+
+		Self->SharedUGCHandle.Value = static_cast<int64>(File);
+		Self->bFileShared = true;
+		Self->OnBranchDone();
+	});
 }
 
 void USAL_UploadScoreWithUGC::StartUploadScore()
 {
 	if (SteamUserStats() == nullptr)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: SteamUserStats is not available for UploadLeaderboardScore."));
+		FailAndJournal(TEXT("[SteamSAL] UploadScoreWithUGC: SteamUserStats is not available for UploadLeaderboardScore."));
 		return;
 	}
 
@@ -170,12 +234,17 @@ void USAL_UploadScoreWithUGC::StartUploadScore()
 	if (InDetails.Num() > 0)
 	{
 		DetailsPtr   = InDetails.GetData();
-		DetailsCount = InDetails.Num();
+		DetailsCount = FMath::Min(InDetails.Num(), 64);
 	}
 
+	const ELeaderboardUploadScoreMethod Method =
+		(InUploadMethod == ESALLeaderboardUploadMethod::ForceUpdate)
+			? k_ELeaderboardUploadScoreMethodForceUpdate
+			: k_ELeaderboardUploadScoreMethodKeepBest;
+
 	SteamAPICall_t ApiCall = SteamUserStats()->UploadLeaderboardScore(
 		SteamHandle,
-		k_ELeaderboardUploadScoreMethodKeepBest,
+		Method,
 		InScore,
 		DetailsPtr,
 		DetailsCount
@@ -183,7 +252,7 @@ void USAL_UploadScoreWithUGC::StartUploadScore()
 
 	if (ApiCall == k_uAPICallInvalid)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: UploadLeaderboardScore returned an invalid API call handle."));
+		FailAndJournal(TEXT("[SteamSAL] UploadScoreWithUGC: UploadLeaderboardScore returned an invalid API call handle."));
 		return;
 	}
 
@@ -194,19 +263,108 @@ void USAL_UploadScoreWithUGC::OnScoreUploaded(LeaderboardScoreUploaded_t* Callba
 {
 	if (bIOFailure || Callback == nullptr)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: UploadLeaderboardScore IO failure."));
+		FailAndJournal(TEXT("[SteamSAL] UploadScoreWithUGC: UploadLeaderboardScore IO failure."));
 		return;
 	}
 
+	const TWeakObjectPtr<USAL_UploadScoreWithUGC> Self(this);
+
 	if (!Callback->m_bSuccess)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: UploadLeaderboardScore reported failure (m_bSuccess == false)."));
+		SAL_RunOnGameThread([Self]()
+		{
+			if (!Self.IsValid()) return;
+			Self->Fail(TEXT("[SteamSAL] UploadScoreWithUGC: UploadLeaderboardScore reported failure (m_bSuccess == false)."));
+		});
+		return;
+	}
+
+	const int64 Handle = InHandle.Value;
+	const int32 UploadedScore = Callback->m_nScore;
+	const bool bScoreChanged = Callback->m_bScoreChanged != 0;
+	const int32 NewGlobalRank = Callback->m_nGlobalRankNew;
+
+	SAL_RunOnGameThread([Self, Handle, UploadedScore, bScoreChanged, NewGlobalRank]()
+	{
+		if (!Self.IsValid()) return;
+
+		if (USAL_MyLeaderboardEntrySubsystem* MyEntry = USAL_MyLeaderboardEntrySubsystem::Get(Self->WorldContextObject))
+		{
+			MyEntry->RecordUpload(Handle, UploadedScore, bScoreChanged, NewGlobalRank);
+		}
+
+		if (Self->bFinished) return;
+
+		Self->InScore = UploadedScore;
+		Self->bScoreUploaded = true;
+		Self->bScoreChanged = bScoreChanged;
+
+		if (Self->bInScoreFirst)
+		{
+			if (!bScoreChanged && Self->InUploadMethod == ESALLeaderboardUploadMethod::KeepBestScore)
+			{
+				Self->FinishWithoutUGC();
+				return;
+			}
+
+			Self->StartFileWrite();
+			return;
+		}
+
+		Self->OnBranchDone();
+	});
+}
+
+void USAL_UploadScoreWithUGC::OnBranchDone()
+{
+	if (!bScoreUploaded)
+	{
+		return;
+	}
+
+	// The file was written in parallel, but attaching it would replace the UGC of the player's better entry.
+	if (!bScoreChanged && InUploadMethod == ESALLeaderboardUploadMethod::KeepBestScore)
+	{
+		FinishWithoutUGC();
+		return;
+	}
+
+	if (!ShareError.IsEmpty())
+	{
+		// The score is on the board already; journaling would upload it a second time.
+		Fail(ShareError + TEXT(" The score was uploaded without UGC."));
+		return;
+	}
+
+	if (bFileShared)
+	{
+		StartAttachUGC();
+	}
+}
+
+void USAL_UploadScoreWithUGC::FailShare(const FString& Why)
+{
+	// Wait for the score branch: if it succeeds the score stays without UGC, if it fails both are journaled.
+	ShareError = Why;
+	OnBranchDone();
+}
+
+void USAL_UploadScoreWithUGC::FinishWithoutUGC()
+{
+	if (bFinished)
+	{
 		return;
 	}
 
-	InScore = Callback->m_nScore;
+	bFinished = true;
 
-	StartAttachUGC();
+	FileWriteCallResult.Cancel();
+	FileShareCallResult.Cancel();
+
+	UE_LOG(LogTemp, Log, TEXT("[SteamSAL] UploadScoreWithUGC: Score %d is not a personal best, UGC skipped."), InScore);
+
+	OnSuccess.Broadcast(InScore, FSAL_UGCHandle());
+	SetReadyToDestroy();
 }
 
 void USAL_UploadScoreWithUGC::StartAttachUGC()
@@ -238,48 +396,89 @@ void USAL_UploadScoreWithUGC::StartAttachUGC()
 
 void USAL_UploadScoreWithUGC::OnUGCAttached(LeaderboardUGCSet_t* Callback, bool bIOFailure)
 {
+	FString Error;
+
 	if (bIOFailure || Callback == nullptr)
 	{
-		Fail(TEXT("[SteamSAL] UploadScoreWithUGC: AttachLeaderboardUGC IO failure or null callback."));
-		return;
+		Error = TEXT("[SteamSAL] UploadScoreWithUGC: AttachLeaderboardUGC IO failure or null callback.");
 	}
-
-	if (Callback->m_eResult != k_EResultOK)
+	else if (Callback->m_eResult != k_EResultOK)
 	{
-		const FString Reason = FString::Printf(
+		Error = FString::Printf(
 			TEXT("[SteamSAL] UploadScoreWithUGC: AttachLeaderboardUGC failed with result %d."),
 			static_cast<int32>(Callback->m_eResult)
 		);
-
-		Fail(Reason);
-		return;
 	}
 
-	const int32          FinalScore  = InScore;
-	const FSAL_UGCHandle FinalHandle = SharedUGCHandle;
+	TWeakObjectPtr<USAL_UploadScoreWithUGC> Self(this);
 
-	UE_LOG(
-		LogTemp,
-		Log,
-		TEXT("[SteamSAL] UploadScoreWithUGC: AttachLeaderboardUGC success (Score=%d, UGCHandle=%lld)."),
-		FinalScore,
-		static_cast<long long>(FinalHandle.Value)
-	);
+	SAL_RunOnGameThread([Self, Error]()
+	{
+		if (!Self.IsValid() || Self->bFinished) return;
+
+		if (!Error.IsEmpty())
+		{
+			Self->Fail(Error);
+			return;
+		}
+
+		const int32          FinalScore  = Self->InScore;
+		const FSAL_UGCHandle FinalHandle = Self->SharedUGCHandle;
+
+		UE_LOG(
+			LogTemp,
+			Log,
+			TEXT("[SteamSAL] UploadScoreWithUGC: AttachLeaderboardUGC success (Score=%d, UGCHandle=%lld)."),
+			FinalScore,
+			static_cast<long long>(FinalHandle.Value)
+		);
 
-	OnSuccess.Broadcast(
-		FinalScore,
-		FinalHandle
-	);
+		Self->bFinished = true;
 
-	SetReadyToDestroy();
+		Self->OnSuccess.Broadcast(
+			FinalScore,
+			FinalHandle
+		);
+
+		Self->SetReadyToDestroy();
+	});
 }
 
 
 void USAL_UploadScoreWithUGC::Fail(const FString& Why)
 {
+	if (bFinished)
+	{
+		return;
+	}
+
+	bFinished = true;
+
+	FileWriteCallResult.Cancel();
+	FileShareCallResult.Cancel();
+	ScoreUploadedCallResult.Cancel();
+	AttachUGCCallResult.Cancel();
+
 	UE_LOG(LogTemp, Warning, TEXT("%s"), *Why);
 
 	OnFailure.Broadcast(Why);
 	SetReadyToDestroy();
 }
 
+void USAL_UploadScoreWithUGC::FailAndJournal(const FString& Why)
+{
+	TWeakObjectPtr<USAL_UploadScoreWithUGC> Self(this);
+
+	SAL_RunOnGameThread([Self, Why]()
+	{
+		if (!Self.IsValid() || Self->bFinished) return;
+
+		// Only reached before the score was accepted, so the replay never uploads it twice.
+		USAL_UploadJournalSubsystem* Journal = USAL_UploadJournalSubsystem::Get(Self->WorldContextObject);
+		const bool bQueued = Journal != nullptr && Journal->JournalUpload(
+			Self->InHandle, Self->InScore, Self->InUploadMethod, Self->InDetails,
+			Self->InUGCFileName, Self->InUGCData);
+
+		Self->Fail(bQueued ? Why + TEXT(" Queued for replay.") : Why);
+	});
+}
@@ -5,6 +5,7 @@
 #include "GameFramework/PlayerState.h"
 #include "OnlineSubsystem.h"
 #include "SALTypes.h"
+#include "SAL_LeaderboardEntryStore.h"
 #include "Engine/Texture2D.h"
 #include "PixelFormat.h"
 #include "Serialization/BulkData.h"
@@ -812,7 +813,7 @@ bool USteamSALBlueprintLibrary::GetDownloadedLeaderboardEntry(
 	PlayerName.Empty();
 	Details.Empty();
 
-	const int32 Count = EntriesData.Entries.Num();
+	const int32 Count = EntriesData.Num();
 	if (Count <= 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[SteamSAL] GetDownloadedLeaderboardEntry: EntriesData is empty."));
@@ -826,19 +827,35 @@ bool USteamSALBlueprintLibrary::GetDownloadedLeaderboardEntry(
 		return false;
 	}
 
-	const FSAL_LeaderboardEntryRow& Row = EntriesData.Entries[Index];
+	FSAL_LeaderboardEntryRow Row;
+	EntriesData.GetRow(Index, Row);
 
-	SteamID    = Row.SteamID;
+	SteamID    = MoveTemp(Row.SteamID);
 	GlobalRank = Row.GlobalRank;
 	Score      = Row.Score;
-	PlayerName = Row.PlayerName;
-	Details    = Row.Details; 
+	PlayerName = MoveTemp(Row.PlayerName);
+	Details    = MoveTemp(Row.Details);
 	bHasUGC	   = Row.bHasUGC;
 	UGCHandle = Row.UGCHandle;
 	
 	return true;
 }
 
+void USteamSALBlueprintLibrary::GetAllDownloadedLeaderboardEntries(
+	const FSAL_LeaderboardEntriesData& EntriesData,
+	TArray<FSAL_LeaderboardEntryRow>& Rows)
+{
+	const int32 Count = EntriesData.Num();
+
+	Rows.Reset(Count);
+	Rows.SetNum(Count);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		EntriesData.GetRow(i, Rows[i]);
+	}
+}
+
 FString USteamSALBlueprintLibrary::FormatLeaderboardScore(
 	int32 Score,
 	ESALLeaderboardDisplayType DisplayType)
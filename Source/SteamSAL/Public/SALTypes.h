@@ -217,12 +217,18 @@ struct FSAL_StatWrite
 	float SessionLengthSeconds = 0.0f;
 };
 
+class FSAL_LeaderboardEntryStore;
+
+using FSAL_LeaderboardEntryStorePtr = TSharedPtr<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe>;
+
 USTRUCT(BlueprintType)
 struct STEAMSAL_API FSAL_LeaderboardEntriesData
 {
 	GENERATED_BODY()
 
-	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard")
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard",
+		meta=(DeprecatedProperty, DeprecationMessage="Download nodes no longer fill Entries; read rows with 'Get Downloaded Leaderboard Entry' or 'Get All Downloaded Leaderboard Entries'.",
+			ToolTip="Materialized rows. Download nodes keep rows in a compact native store instead; use 'Get Downloaded Leaderboard Entry' (or 'Get All Downloaded Leaderboard Entries') to read them."))
 	TArray<FSAL_LeaderboardEntryRow> Entries;
 
 	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard")
@@ -230,5 +236,109 @@ struct STEAMSAL_API FSAL_LeaderboardEntriesData
 
 	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard")
 	ELeaderboardRequestType RequestType = ELeaderboardRequestType::Global;
+
+	// Columnar rows filled by the download nodes. Shared, so copying this struct does not copy rows.
+	FSAL_LeaderboardEntryStorePtr Store;
+
+	int32 Num() const;
+	bool GetRow(int32 Index, FSAL_LeaderboardEntryRow& OutRow) const;
+
+	uint64 GetSteamID64(int32 Index) const;
+	int32 GetGlobalRank(int32 Index) const;
+	int32 GetScore(int32 Index) const;
+
+	/** Returns Store, or a store built from the legacy Entries array when there is none. */
+	FSAL_LeaderboardEntryStorePtr GetOrBuildStore() const;
+};
+
+
+USTRUCT(BlueprintType)
+struct FSAL_LeaderboardShardResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="Zero-based shard index. Shard N covers users [N*100 .. N*100+99] of the parsed input list."))
+	int32 ShardIndex = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="True if this shard downloaded successfully."))
+	bool bOk = false;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="Why this shard failed. Empty on success."))
+	FString Error;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="Number of users requested by this shard."))
+	int32 UserCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="Number of entries this shard returned."))
+	int32 EntryCount = 0;
 };
 
+USTRUCT(BlueprintType)
+struct FSAL_LeaderboardInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="Leaderboard name as passed to FindLeaderboard."))
+	FString LeaderboardName;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard")
+	FSAL_LeaderboardHandle LeaderboardHandle;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard")
+	ESALLeaderboardSortMethod SortMethod = ESALLeaderboardSortMethod::Descending;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard")
+	ESALLeaderboardDisplayType DisplayType = ESALLeaderboardDisplayType::Numeric;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="Entry count when this snapshot was taken. Use 'Get Leaderboard Entry Count' for the live value."))
+	int32 EntryCount = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FSAL_ScoreStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Analytics")
+	int32 Count = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Analytics")
+	int32 MinScore = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Analytics")
+	int32 MaxScore = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Analytics")
+	float MeanScore = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FSAL_UploadScoreResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard")
+	FSAL_LeaderboardHandle LeaderboardHandle;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="True if Steam accepted the upload."))
+	bool bOk = false;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="Why the upload failed. Empty on success."))
+	FString Error;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="Score Steam reports for this upload."))
+	int32 Score = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="False if a KeepBest upload did not beat the stored score."))
+	bool bScoreChanged = false;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard", meta=(ToolTip="Global rank after the upload. 0 if unknown."))
+	int32 NewGlobalRank = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="Global rank before the upload. 0 if the user had no entry."))
+	int32 PreviousGlobalRank = 0;
+};
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SALTypes.h"
+
+#include "SAL_DiffLeaderboardEntries.generated.h"
+
+USTRUCT(BlueprintType)
+struct FSAL_LeaderboardDiffRow
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Player's SteamID64."))
+	FString SteamID;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Player's name from the newer entries (older ones if the player left)."))
+	FString PlayerName;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Rank in the older entries. 0 if the player entered."))
+	int32 OldRank = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Rank in the newer entries. 0 if the player left."))
+	int32 NewRank = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff")
+	int32 OldScore = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff")
+	int32 NewScore = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Places gained (OldRank - NewRank). Positive = moved up."))
+	int32 RankDelta = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="NewScore - OldScore."))
+	int32 ScoreDelta = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FSAL_LeaderboardDiff
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Players only in the newer entries."))
+	TArray<FSAL_LeaderboardDiffRow> Entered;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Players only in the older entries."))
+	TArray<FSAL_LeaderboardDiffRow> Left;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Players in both whose rank changed."))
+	TArray<FSAL_LeaderboardDiffRow> RankChanged;
+
+	UPROPERTY(BlueprintReadOnly, Category="SteamSAL|Leaderboard|Diff", meta=(ToolTip="Players in both whose score changed."))
+	TArray<FSAL_LeaderboardDiffRow> ScoreChanged;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnLeaderboardDiffCompleted, const FSAL_LeaderboardDiff&, Diff);
+
+/**
+ * Diffs two leaderboard downloads by SteamID in linear time.
+ * Matching runs on a worker thread over the immutable SteamID/rank/score columns; only changed rows are
+ * materialized back on the GameThread, where player names are read.
+ */
+UCLASS()
+class STEAMSAL_API USAL_DiffLeaderboardEntries : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Row indices produced by Diff(). Pairs are (OldIndex, NewIndex). */
+	struct FIndexDiff
+	{
+		TArray<int32> Entered;
+		TArray<int32> Left;
+		TArray<TPair<int32, int32>> RankChanged;
+		TArray<TPair<int32, int32>> ScoreChanged;
+	};
+
+	/** Hash-joins both stores on SteamID. Safe on any thread as long as the stores are not being appended to. */
+	static void Diff(const FSAL_LeaderboardEntryStore& Old, const FSAL_LeaderboardEntryStore& New, FIndexDiff& Out);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard",
+		meta=(WorldContext="WorldContextObject",
+			BlueprintInternalUseOnly="true",
+			ToolTip="Compares two downloads of the same leaderboard and reports who entered, left, moved or changed score.",
+			Keywords="steam leaderboard diff compare changes moved overtook rank score delta"),
+		DisplayName="Diff Leaderboard Entries")
+	static USAL_DiffLeaderboardEntries* DiffLeaderboardEntries(
+		UObject* WorldContextObject,
+		const FSAL_LeaderboardEntriesData& OldEntries,
+		const FSAL_LeaderboardEntriesData& NewEntries);
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard")
+	FSAL_OnLeaderboardDiffCompleted OnCompleted;
+
+	virtual void Activate() override;
+
+private:
+	FSAL_LeaderboardEntryStorePtr OldStore;
+	FSAL_LeaderboardEntryStorePtr NewStore;
+
+	void OnDiffReady(const FIndexDiff& IndexDiff);
+};
@@ -27,6 +27,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard",
 		meta=(WorldContext="WorldContextObject",
 			BlueprintInternalUseOnly="true",
+			AdvancedDisplay="ConversionBudgetMicroseconds,DetailsMax,bRefreshIfChanged",
 			ToolTip=
 			"Download leaderboard entries by range or request type (Global, Around User, Friends).\nUse RangeStart and RangeEnd for the range of results, or 0,0 for Friends."
 			, Keywords="steam leaderboard download entries range around user friends scores ranks"),
@@ -48,9 +49,30 @@ public:
 			meta=(ToolTip=
 				"End index for entries (inclusive).\nFor Global: higher = more entries.\nFor AroundUser: positive = entries after user."
 			))
-		int32 RangeEnd
+		int32 RangeEnd,
+		UPARAM(
+			meta=(ToolTip=
+				"0 converts all downloaded rows at once.\nAbove 0, rows are converted over several frames, spending at most this many microseconds per frame."
+			))
+		int32 ConversionBudgetMicroseconds = 0,
+		UPARAM(
+			meta=(ToolTip=
+				"Maximum detail ints kept per entry (0..64).\nUse 0 if the board has no details; nothing is requested or stored for them."
+			))
+		int32 DetailsMax = 64,
+		UPARAM(
+			meta=(DisplayName="Refresh If Changed", ToolTip=
+				"Before downloading again, compare the board's entry count and the first and last rows of the last result of this query.\nIf they match, the last result is returned without the full download. Not used for Friends."
+			))
+		bool bRefreshIfChanged = false
 	);
 
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard",
+		meta=(WorldContext="WorldContextObject",
+			DisplayName="Get Leaderboard Refresh Probe Stats",
+			ToolTip="How many 'Refresh If Changed' probes ran in this game instance, and how many of them skipped the full download because nothing changed."))
+	static void GetRefreshProbeStats(UObject* WorldContextObject, int32& Probes, int32& SkippedDownloads);
+
 	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard")
 	FSAL_OnLeaderboardEntriesDataSuccess OnSuccess;
 
@@ -68,10 +90,11 @@ private:
 	ELeaderboardRequestType InRequestType = ELeaderboardRequestType::Global;
 	int32 InRangeStart = 1;
 	int32 InRangeEnd = 10;
-	int32 InDetailsMax = 0;
-
-	CCallResult<USAL_DownloadLeaderboardEntries, LeaderboardScoresDownloaded_t> CallResult;
+	int32 InDetailsMax = 64;
+	int32 InConversionBudgetMicroseconds = 0;
+	bool bInRefreshIfChanged = false;
 
-	void OnScoresDownloaded(LeaderboardScoresDownloaded_t* Callback, bool bIOFailure);
+	void StartDownload();
+	void OnEntriesDownloaded(bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error);
 	void Fail(const FString& Why);
 };
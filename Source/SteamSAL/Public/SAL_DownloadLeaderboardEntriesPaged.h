@@ -0,0 +1,99 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SALTypes.h"
+
+#include "SAL_DownloadLeaderboardEntriesPaged.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FSAL_OnLeaderboardEntriesPage,
+                                               const FSAL_LeaderboardEntriesData&, PageData,
+                                               int32, PageIndex,
+                                               int32, PageFirstRank);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnLeaderboardEntriesPagedCompleted,
+                                            int32, TotalEntryCount);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnLeaderboardEntriesPagedFailure,
+                                            const FString&, ErrorMessage);
+
+/**
+ * Streaming variant of 'Download Steam Leaderboard Entries'.
+ * - Splits [RangeStart..RangeEnd] into pages of PageSize entries.
+ * - Keeps up to MaxPagesInFlight Steam requests running at once.
+ * - Broadcasts OnPage as soon as each page is converted (pages may arrive out of order; use PageIndex),
+ *   then OnCompleted once every page has been delivered.
+ * Friends requests are not range based and are delivered as a single page.
+ * Pages go through the download coalescer, so identical pages requested elsewhere share one Steam call.
+ */
+UCLASS()
+class STEAMSAL_API USAL_DownloadLeaderboardEntriesPaged : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard",
+		meta=(WorldContext="WorldContextObject",
+			BlueprintInternalUseOnly="true",
+			AdvancedDisplay="PageSize,MaxPagesInFlight,DetailsMax",
+			ToolTip=
+			"Downloads a large leaderboard range page by page.\nOnPage fires for every page as soon as it arrives; OnCompleted fires after the last page."
+			, Keywords="steam leaderboard download entries range paged pages stream streaming"),
+		DisplayName="Download Steam Leaderboard Entries (Paged)")
+	static USAL_DownloadLeaderboardEntriesPaged* DownloadLeaderboardEntriesPaged(
+		UObject* WorldContextObject,
+		UPARAM(meta=(ToolTip="Valid leaderboard handle obtained from FindLeaderboard"))
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		UPARAM(meta=(ToolTip="Global or Global Around User. Friends is delivered as one page."))
+		ELeaderboardRequestType RequestType,
+		UPARAM(meta=(ToolTip="Start index for entries.\nFor Global: 1 = top rank.\nFor AroundUser: negative = entries before user."))
+		int32 RangeStart,
+		UPARAM(meta=(ToolTip="End index for entries (inclusive)."))
+		int32 RangeEnd,
+		UPARAM(meta=(ToolTip="Number of entries per page."))
+		int32 PageSize = 100,
+		UPARAM(meta=(ToolTip="How many page requests may be pending at the same time."))
+		int32 MaxPagesInFlight = 2,
+		UPARAM(meta=(ToolTip="Maximum detail ints kept per entry (0..64). Use 0 if the board has no details."))
+		int32 DetailsMax = 64
+	);
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard")
+	FSAL_OnLeaderboardEntriesPage OnPage;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard")
+	FSAL_OnLeaderboardEntriesPagedCompleted OnCompleted;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard")
+	FSAL_OnLeaderboardEntriesPagedFailure OnFailure;
+
+	virtual void Activate() override;
+
+private:
+	UPROPERTY()
+	UObject* WorldContextObject = nullptr;
+
+	FSAL_LeaderboardHandle InHandle{};
+	ELeaderboardRequestType InRequestType = ELeaderboardRequestType::Global;
+	int32 InRangeStart = 1;
+	int32 InRangeEnd = 100;
+	int32 InPageSize = 100;
+	int32 InMaxPagesInFlight = 2;
+	int32 InDetailsMax = 64;
+
+	int32 NumPages = 0;
+	int32 NextPageToIssue = 0;
+	int32 NumPagesInFlight = 0;
+	int32 NumPagesDelivered = 0;
+	int32 TotalDelivered = 0;
+	bool bReachedEnd = false;
+	bool bFinished = false;
+
+	void IssuePages();
+	bool IssuePage(int32 PageIndex);
+	void OnPageConverted(int32 PageIndex, const FSAL_LeaderboardEntriesData& PageData, int32 RequestedCount);
+	void Finish();
+	void Fail(const FString& Why);
+};
@@ -34,13 +34,16 @@ public:
 		meta=(
 			BlueprintInternalUseOnly="true",
 			WorldContext="WorldContextObject",
+			AdvancedDisplay="DetailsMax",
 			DisplayName="Download Steam Leaderboard Entries (Users)",
 			Keywords="Steam Leaderboard Download Entries Users Friends Ranks Scores IDs Player"
 		))
 	static USAL_DownloadLeaderboardForUsers* DownloadEntriesForUsers(
 		UObject* WorldContextObject,
 		FSAL_LeaderboardHandle LeaderboardHandle,
-		const TArray<FString>& SteamIDs
+		const TArray<FString>& SteamIDs,
+		UPARAM(meta=(ToolTip="Maximum detail ints kept per entry (0..64). Use 0 if the board has no details."))
+		int32 DetailsMax = 64
 	);
 
 	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard",
@@ -63,6 +66,8 @@ private:
 	UPROPERTY()
 	TArray<FString> InSteamId64Strings;
 
+	int32 InDetailsMax = 64;
+
 	CCallResult<USAL_DownloadLeaderboardForUsers, LeaderboardScoresDownloaded_t> DownloadCallResult;
 
 	void OnScoresDownloaded(LeaderboardScoresDownloaded_t* Callback, bool bIOFailure);
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SALTypes.h"
+#include "SAL_PendingCall.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+#include "SAL_DownloadLeaderboardForUsersSharded.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
+	FSAL_OnDownloadEntriesForUsersShardedSuccess,
+	const FSAL_LeaderboardEntriesData&, EntriesData,
+	int32, EntryCount,
+	const TArray<FSAL_LeaderboardShardResult>&, ShardResults
+);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+	FSAL_OnDownloadEntriesForUsersShardedFailure,
+	const FString&, Error,
+	const TArray<FSAL_LeaderboardShardResult>&, ShardResults
+);
+
+/**
+ * Variant of 'Download Steam Leaderboard Entries (Users)' for more than 100 users.
+ * - Splits the (deduplicated) SteamID list into shards of 100, Steam's per-call limit.
+ * - Keeps up to MaxConcurrentShards Steam requests running at once.
+ * - Merges every successful shard into one entry set sorted by global rank and broadcasts once.
+ * OnSuccess fires if at least one shard succeeded; ShardResults tells which shards failed and why.
+ */
+UCLASS()
+class STEAMSAL_API USAL_DownloadLeaderboardForUsersSharded : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+public:
+
+	UFUNCTION(BlueprintCallable,
+		Category="SteamSAL|Leaderboard",
+		meta=(
+			BlueprintInternalUseOnly="true",
+			WorldContext="WorldContextObject",
+			AdvancedDisplay="MaxConcurrentShards,DetailsMax",
+			DisplayName="Download Steam Leaderboard Entries (Users, Sharded)",
+			Keywords="Steam Leaderboard Download Entries Users Friends Clan Roster Lobby Many Batch Shard Ranks Scores IDs Player"
+		))
+	static USAL_DownloadLeaderboardForUsersSharded* DownloadEntriesForUsersSharded(
+		UObject* WorldContextObject,
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		const TArray<FString>& SteamIDs,
+		UPARAM(meta=(ToolTip="How many 100-user requests may be pending at the same time."))
+		int32 MaxConcurrentShards = 4,
+		UPARAM(meta=(ToolTip="Maximum detail ints kept per entry (0..64). Use 0 if the board has no details."))
+		int32 DetailsMax = 64
+	);
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="Fires once with the merged entries (sorted by global rank) when every shard has finished and at least one succeeded."))
+	FSAL_OnDownloadEntriesForUsersShardedSuccess OnSuccess;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="Fires if the request could not start or every shard failed."))
+	FSAL_OnDownloadEntriesForUsersShardedFailure OnFailure;
+
+	virtual void Activate() override;
+
+	static constexpr int32 kUsersPerShard = 100;
+
+private:
+	UPROPERTY()
+	UObject* WorldContextObject = nullptr;
+
+	UPROPERTY()
+	FSAL_LeaderboardHandle InHandle;
+
+	UPROPERTY()
+	TArray<FString> InSteamId64Strings;
+
+	int32 InMaxConcurrentShards = 4;
+	int32 InDetailsMax = 64;
+
+	TArray<CSteamID> SteamIDs;
+	TArray<FSAL_LeaderboardShardResult> ShardResults;
+	TArray<FSAL_LeaderboardEntryStorePtr> ShardStores;
+	TArray<TUniquePtr<TSAL_PendingCall<LeaderboardScoresDownloaded_t>>> ShardCalls;
+
+	int32 NumShards = 0;
+	int32 NextShardToIssue = 0;
+	int32 NumShardsInFlight = 0;
+	int32 NumShardsDone = 0;
+
+	void IssueShards();
+	void IssueShard(int32 ShardIndex);
+	void OnShardDone(int32 ShardIndex, const FSAL_LeaderboardEntryStorePtr& Store, const FString& Error);
+	void Finish();
+	void Fail(const FString& Why);
+};
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SALTypes.h"
+
+#include "SAL_DownloadLeaderboardRangeCached.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FSAL_OnLeaderboardRangeCachedSuccess,
+                                               const FSAL_LeaderboardEntriesData&, EntriesData,
+                                               int32, EntryCount,
+                                               int32, DownloadedRanges);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnLeaderboardRangeCachedFailure, const FString&, ErrorMessage);
+
+/**
+ * Global range download backed by the leaderboard cache's sparse rank index.
+ * Only the parts of [RangeStart..RangeEnd] not cached within the board's TTL are downloaded;
+ * the result is assembled from cached and new rows.
+ */
+UCLASS()
+class STEAMSAL_API USAL_DownloadLeaderboardRangeCached : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Cache",
+		meta=(WorldContext="WorldContextObject",
+			BlueprintInternalUseOnly="true",
+			AdvancedDisplay="DetailsMax",
+			ToolTip=
+			"Downloads Global leaderboard ranks [RangeStart..RangeEnd], fetching only the ranks that are not cached yet.\nDownloadedRanges is the number of Steam requests that were needed (0 = fully cached)."
+			, Keywords="steam leaderboard download entries range global cached sparse gaps scroll"),
+		DisplayName="Download Steam Leaderboard Range (Cached)")
+	static USAL_DownloadLeaderboardRangeCached* DownloadLeaderboardRangeCached(
+		UObject* WorldContextObject,
+		UPARAM(meta=(ToolTip="Valid leaderboard handle obtained from FindLeaderboard"))
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		UPARAM(meta=(ToolTip="First global rank (1 = top)."))
+		int32 RangeStart,
+		UPARAM(meta=(ToolTip="Last global rank (inclusive)."))
+		int32 RangeEnd,
+		UPARAM(meta=(ToolTip="Maximum detail ints kept per entry (0..64). Use 0 if the board has no details."))
+		int32 DetailsMax = 64
+	);
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Cache")
+	FSAL_OnLeaderboardRangeCachedSuccess OnSuccess;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Cache")
+	FSAL_OnLeaderboardRangeCachedFailure OnFailure;
+
+	virtual void Activate() override;
+
+private:
+	UPROPERTY()
+	UObject* WorldContextObject = nullptr;
+
+	FSAL_LeaderboardHandle InHandle{};
+	int32 InRangeStart = 1;
+	int32 InRangeEnd = 10;
+	int32 InDetailsMax = 64;
+	int32 NumDownloads = 0;
+
+	void OnRangeReady(bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error);
+};
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SALTypes.h"
+
+#include "SAL_EstimateLeaderboardPercentile.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FSAL_OnLeaderboardPercentileEstimated,
+                                              float, TopPercent,
+                                              int32, EstimatedRank,
+                                              int32, BestRank,
+                                              int32, WorstRank,
+                                              int32, TotalEntries);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnLeaderboardPercentileFailure, const FString&, ErrorMessage);
+
+/**
+ * "Top X%" for a score from a handful of single-rank downloads (see USAL_PercentileEstimatorSubsystem).
+ * Repeated estimates on the same board reuse its sampled curve until it expires.
+ */
+UCLASS()
+class STEAMSAL_API USAL_EstimateLeaderboardPercentile : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Prediction",
+		meta=(WorldContext="WorldContextObject",
+			BlueprintInternalUseOnly="true",
+			AdvancedDisplay="NumSamples,RefineSamples",
+			ToolTip=
+			"Estimates which top percentage of the leaderboard a score falls in, using a few single-entry downloads instead of the whole board.\nThe real rank lies within [Best Rank..Worst Rank]."
+			, Keywords="steam leaderboard percentile top percent estimate badge sample"),
+		DisplayName="Estimate Steam Leaderboard Percentile")
+	static USAL_EstimateLeaderboardPercentile* EstimateLeaderboardPercentile(
+		UObject* WorldContextObject,
+		UPARAM(meta=(ToolTip="Valid leaderboard handle obtained from FindLeaderboard"))
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		int32 Score,
+		UPARAM(meta=(ToolTip="Ranks sampled when the board's curve is built (2..32)."))
+		int32 NumSamples = 8,
+		UPARAM(meta=(ToolTip="Extra ranks sampled around this score per refinement round (0..16). 0 only uses the curve."))
+		int32 RefineSamples = 2
+	);
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Prediction")
+	FSAL_OnLeaderboardPercentileEstimated OnSuccess;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Prediction")
+	FSAL_OnLeaderboardPercentileFailure OnFailure;
+
+	virtual void Activate() override;
+
+private:
+	UPROPERTY()
+	UObject* WorldContextObject = nullptr;
+
+	FSAL_LeaderboardHandle InHandle{};
+	int32 InScore = 0;
+	int32 InNumSamples = 8;
+	int32 InRefineSamples = 2;
+};
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SALTypes.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_RankRangeIndex.h"
+
+#include "SAL_LeaderboardCacheSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FSAL_OnCachedLeaderboardUpdated,
+                                              FSAL_LeaderboardHandle, LeaderboardHandle,
+                                              ELeaderboardRequestType, RequestType,
+                                              int32, RangeStart,
+                                              int32, RangeEnd,
+                                              const FSAL_LeaderboardEntriesData&, EntriesData);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FSAL_OnCachedLeaderboardRefreshFailed,
+                                              FSAL_LeaderboardHandle, LeaderboardHandle,
+                                              ELeaderboardRequestType, RequestType,
+                                              int32, RangeStart,
+                                              int32, RangeEnd,
+                                              const FString&, Error);
+
+/**
+ * Per game-instance cache of downloaded leaderboard entries.
+ * - Keyed by leaderboard handle and query (request type, range, details max).
+ * - Entries older than the board's TTL are served stale while a background refresh runs.
+ *   On a miss, the query's on-disk snapshot (if any) is served as stale entries the same way.
+ * - OnEntriesUpdated only fires when a refresh produced different rows; OnRefreshFailed fires when a refresh fails,
+ *   and the query is not refreshed again for RefreshRetrySeconds.
+ * - Least recently read queries are evicted once MemoryBudgetBytes is exceeded.
+ * - Global rank ranges can also be served from a per-board sparse index (RequestGlobalRange), which downloads only
+ *   the sub-ranges not already cached within the board's TTL. Its segments count toward MemoryBudgetBytes and are
+ *   evicted by the same least-recently-read order as queries.
+ */
+UCLASS()
+class STEAMSAL_API USAL_LeaderboardCacheSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_LeaderboardCacheSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Cache",
+		meta=(DisplayName="Get Cached Leaderboard Entries",
+			AdvancedDisplay="DetailsMax",
+			ToolTip=
+			"Returns cached entries for this query immediately (if any) and refreshes them in the background when missing or older than the board's TTL.\nListen to OnEntriesUpdated for fresh rows.",
+			Keywords="steam leaderboard cache cached entries ttl stale refresh"))
+	bool GetEntries(
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		ELeaderboardRequestType RequestType,
+		int32 RangeStart,
+		int32 RangeEnd,
+		FSAL_LeaderboardEntriesData& EntriesData,
+		UPARAM(DisplayName="Is Stale") bool& bIsStale,
+		int32 DetailsMax = 64);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Cache",
+		meta=(DisplayName="Set Leaderboard Cache TTL",
+			ToolTip="Sets how many seconds cached entries of this leaderboard count as fresh. Zero or less uses DefaultTTLSeconds."))
+	void SetBoardTTL(FSAL_LeaderboardHandle LeaderboardHandle, float TTLSeconds);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Cache",
+		meta=(DisplayName="Invalidate Leaderboard Cache",
+			ToolTip="Drops every cached query of this leaderboard."))
+	void InvalidateBoard(FSAL_LeaderboardHandle LeaderboardHandle);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Cache",
+		meta=(DisplayName="Clear Leaderboard Cache"))
+	void ClearCache();
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Cache",
+		meta=(DisplayName="Get Leaderboard Cache Stats"))
+	void GetCacheStats(int32& NumQueries, int64& UsedBytes, int32& Hits, int32& Misses, int32& Refreshes) const;
+
+	/** Stores entries for a query as if they had just been downloaded. Fires OnEntriesUpdated if the rows changed. */
+	void Put(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData);
+
+	/**
+	 * Returns the Global rows [RangeStart..RangeEnd], downloading only the parts missing from the board's rank index.
+	 * OnComplete runs on the GameThread; immediately if everything was cached.
+	 */
+	void RequestGlobalRange(FSAL_LeaderboardHandle LeaderboardHandle, int32 RangeStart, int32 RangeEnd, int32 DetailsMax,
+	                        FSAL_LeaderboardDownloadCoalescer::FOnComplete OnComplete, int32* OutNumDownloads = nullptr);
+
+	/** Calls Visitor for every cached entry set of a leaderboard (all boards when Handle is 0). */
+	void ForEachCached(int64 Handle, TFunctionRef<void(const FSAL_LeaderboardQueryKey&, const FSAL_LeaderboardEntriesData&)> Visitor) const;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Cache")
+	FSAL_OnCachedLeaderboardUpdated OnEntriesUpdated;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Cache")
+	FSAL_OnCachedLeaderboardRefreshFailed OnRefreshFailed;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Cache",
+		meta=(ToolTip="Seconds after a failed refresh before the same query is requested from Steam again."))
+	float RefreshRetrySeconds = 10.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Cache",
+		meta=(ToolTip="Seconds cached entries stay fresh for boards without their own TTL."))
+	float DefaultTTLSeconds = 30.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Cache",
+		meta=(ToolTip="Approximate memory the cache may use before evicting least recently read queries."))
+	int64 MemoryBudgetBytes = 16 * 1024 * 1024;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Cache",
+		meta=(ToolTip="Per-frame microsecond budget for converting background refreshes. 0 converts each refresh at once."))
+	int32 RefreshConversionBudgetMicroseconds = 0;
+
+private:
+	struct FCachedQuery
+	{
+		FSAL_LeaderboardEntriesData Data;
+		double FetchedAt = 0.0;
+		double LastReadAt = 0.0;
+		uint32 ContentHash = 0;
+		SIZE_T Bytes = 0;
+		bool bRefreshing = false;
+	};
+
+	TMap<FSAL_LeaderboardQueryKey, FCachedQuery> Cache;
+
+	// Refreshes of queries with nothing cached yet (cached queries use FCachedQuery::bRefreshing).
+	TSet<FSAL_LeaderboardQueryKey> ColdRefreshes;
+
+	// Queries whose last refresh failed, with the time they may be requested again.
+	TMap<FSAL_LeaderboardQueryKey, double> RetryAfter;
+
+	// Sparse Global caches, keyed by (leaderboard handle, details max).
+	TMap<TPair<int64, int32>, TSharedPtr<FSAL_RankRangeIndex>> RankIndexes;
+	TMap<int64, float> BoardTTLs;
+	SIZE_T TotalBytes = 0;
+
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+	int32 NumRefreshes = 0;
+
+	float GetTTL(int64 Handle) const;
+	void Refresh(const FSAL_LeaderboardQueryKey& Key);
+	void OnRefreshed(const FSAL_LeaderboardQueryKey& Key, bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error);
+	void OnRefreshFailedInternal(const FSAL_LeaderboardQueryKey& Key, const FString& Error);
+	void EnforceBudget();
+	void UpdateIndexBytes(FSAL_RankRangeIndex& Index, SIZE_T OldBytes);
+	void FinishGlobalRange(const TPair<int64, int32>& IndexKey, int32 RangeStart, int32 RangeEnd,
+	                       const FSAL_LeaderboardDownloadCoalescer::FOnComplete& OnComplete);
+};
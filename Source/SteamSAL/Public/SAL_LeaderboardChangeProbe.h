@@ -0,0 +1,64 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+
+/**
+ * Cheap "did this query change?" check in front of a full leaderboard download.
+ * - Remember() stores the last full result of a query with its fingerprint: the board's entry count and the
+ *   first and last rows (SteamID, rank, score).
+ * - Probe() downloads only the first and last rows (two single-rank Global requests) and reads GetLeaderboardEntryCount
+ *   once they land, since Steam refreshes the count only with a download. If the fingerprint still matches, the
+ *   remembered entries are returned and the full download can be skipped.
+ * - Friends queries and empty results have no usable fingerprint and are never probed.
+ * - Each GameInstance has its own probe, so PIE clients never share or clear each other's fingerprints. The probe of
+ *   a GameInstance that is gone is dropped by the next Get(). At most MaxRemembered queries are kept per probe,
+ *   least recently used first out.
+ * - All calls and callbacks are on the GameThread.
+ */
+class STEAMSAL_API FSAL_LeaderboardChangeProbe : public TSharedFromThis<FSAL_LeaderboardChangeProbe>
+{
+public:
+	using FOnProbed = TFunction<void(bool bUnchanged, const FSAL_LeaderboardEntriesData& Remembered)>;
+
+	/** The probe of WorldContextObject's GameInstance. */
+	static FSAL_LeaderboardChangeProbe& Get(const UObject* WorldContextObject);
+
+	void Remember(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData);
+	void Forget(int64 Handle);
+
+	/** Starts a probe for Key. Returns false if Key has nothing remembered to compare against. */
+	bool Probe(const FSAL_LeaderboardQueryKey& Key, FOnProbed OnProbed);
+
+	int32 GetNumProbes() const { return NumProbes; }
+	int32 GetNumSkipped() const { return NumSkipped; }
+
+private:
+	struct FFingerprint
+	{
+		int32 EntryCount = 0;
+		uint64 FirstSteamID = 0;
+		int32 FirstRank = 0;
+		int32 FirstScore = 0;
+		uint64 LastSteamID = 0;
+		int32 LastRank = 0;
+		int32 LastScore = 0;
+	};
+
+	struct FRemembered
+	{
+		FSAL_LeaderboardEntriesData Data;
+		FFingerprint Fingerprint;
+		double LastUsedAt = 0.0;
+	};
+
+	static constexpr int32 MaxRemembered = 32;
+
+	TMap<FSAL_LeaderboardQueryKey, FRemembered> Remembered;
+
+	int32 NumProbes = 0;
+	int32 NumSkipped = 0;
+};
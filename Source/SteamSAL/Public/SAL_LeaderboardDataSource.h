@@ -0,0 +1,106 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "SALTypes.h"
+
+#include "SAL_LeaderboardDataSource.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FSAL_OnDataSourceRowsLoaded, int32, FirstIndex, int32, Count);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnDataSourceFailure, const FString&, ErrorMessage);
+
+/**
+ * Virtualized view over a Global leaderboard for scrolling lists.
+ * - Reports the board size from GetLeaderboardEntryCount; rows are downloaded in pages only when asked for.
+ * - Index 0 is global rank 1. GetRow returns false for rows whose page is still loading; OnRowsLoaded fires when it lands.
+ * - Pages are kept in an LRU under MemoryBudgetBytes; pages inside the visible range are never evicted.
+ * - SetVisibleRange also prefetches the next page in the scroll direction.
+ * - A page that failed is not requested again for FailureRetrySeconds; OnFailure fires at most once per that window.
+ * Binding to a list widget is left to the caller; no UMG items are created. UListView needs one item UObject per row,
+ * which is what this source avoids for large boards, so drive a fixed set of row widgets from a scroll offset instead:
+ * call SetVisibleRange with the rows on screen and fill each widget with GetRow, refreshing on OnRowsLoaded.
+ */
+UCLASS(BlueprintType)
+class STEAMSAL_API USAL_LeaderboardDataSource : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|DataSource",
+		meta=(WorldContext="WorldContextObject",
+			AdvancedDisplay="MemoryBudgetBytes,DetailsMax",
+			DisplayName="Create Leaderboard Data Source",
+			Keywords="steam leaderboard list view virtual virtualized scroll paging data source"))
+	static USAL_LeaderboardDataSource* CreateLeaderboardDataSource(
+		UObject* WorldContextObject,
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		int32 PageSize = 50,
+		int64 MemoryBudgetBytes = 4 * 1024 * 1024,
+		int32 DetailsMax = 64);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|DataSource",
+		meta=(ToolTip="Number of rows on the board (Steam's entry count when the source was created or last refreshed)."))
+	int32 GetTotalCount() const { return TotalCount; }
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|DataSource",
+		meta=(ToolTip="Re-reads the entry count from Steam and drops every loaded page."))
+	void Refresh();
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|DataSource",
+		meta=(ToolTip="Fills Row if its page is loaded. Otherwise requests the page and returns false; OnRowsLoaded fires when it arrives."))
+	bool GetRow(int32 Index, FSAL_LeaderboardEntryRow& Row);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|DataSource",
+		meta=(ToolTip="Tell the source which rows are on screen. Loads their pages and prefetches the next page in the scroll direction."))
+	void SetVisibleRange(int32 FirstIndex, int32 LastIndex);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|DataSource")
+	int32 GetNumLoadedPages() const { return Pages.Num(); }
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|DataSource")
+	FSAL_OnDataSourceRowsLoaded OnRowsLoaded;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|DataSource")
+	FSAL_OnDataSourceFailure OnFailure;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|DataSource",
+		meta=(ToolTip="Seconds after a failed page download before GetRow or SetVisibleRange requests that page again."))
+	float FailureRetrySeconds = 5.0f;
+
+private:
+	struct FPage
+	{
+		FSAL_LeaderboardEntriesData Data;
+		double LastUsedAt = 0.0;
+		SIZE_T Bytes = 0;
+	};
+
+	FSAL_LeaderboardHandle Handle{};
+	int32 PageSize = 50;
+	int64 MemoryBudgetBytes = 0;
+	int32 DetailsMax = 64;
+	int32 TotalCount = 0;
+
+	int32 VisibleFirstPage = 0;
+	int32 VisibleLastPage = -1;
+	int32 LastVisibleFirstIndex = 0;
+
+	// Bumped by Refresh(); pages requested before it are discarded when they land.
+	int32 Generation = 0;
+
+	TMap<int32, FPage> Pages;
+	TSet<int32> PendingPages;
+
+	// Pages whose last download failed, with the time they may be requested again.
+	TMap<int32, double> PageRetryAt;
+	double NextFailureBroadcastAt = 0.0;
+	SIZE_T TotalBytes = 0;
+
+	void RequestPage(int32 PageIndex);
+	void OnPageLoaded(int32 PageIndex, int32 RequestGeneration, bool bOk, const FSAL_LeaderboardEntriesData& PageData, const FString& Error);
+	void OnPageFailed(int32 PageIndex, const FString& Error);
+	void EnforceBudget();
+	int32 GetNumPages() const;
+};
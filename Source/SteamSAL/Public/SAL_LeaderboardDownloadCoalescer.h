@@ -0,0 +1,91 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+#include "SAL_PendingCall.h"
+
+#include <atomic>
+
+/** Identifies one DownloadLeaderboardEntries query. Friends queries ignore the range. */
+struct STEAMSAL_API FSAL_LeaderboardQueryKey
+{
+	int64 Handle = 0;
+	ELeaderboardRequestType RequestType = ELeaderboardRequestType::Global;
+	int32 RangeStart = 0;
+	int32 RangeEnd = 0;
+	int32 DetailsMax = 0;
+
+	FSAL_LeaderboardQueryKey() = default;
+	FSAL_LeaderboardQueryKey(const FSAL_LeaderboardHandle& InHandle, ELeaderboardRequestType InRequestType,
+	                         int32 InRangeStart, int32 InRangeEnd, int32 InDetailsMax);
+
+	bool operator==(const FSAL_LeaderboardQueryKey& Other) const
+	{
+		return Handle == Other.Handle
+			&& RequestType == Other.RequestType
+			&& RangeStart == Other.RangeStart
+			&& RangeEnd == Other.RangeEnd
+			&& DetailsMax == Other.DetailsMax;
+	}
+
+	friend uint32 GetTypeHash(const FSAL_LeaderboardQueryKey& K)
+	{
+		uint32 Hash = ::GetTypeHash(K.Handle);
+		Hash = HashCombine(Hash, ::GetTypeHash(static_cast<uint8>(K.RequestType)));
+		Hash = HashCombine(Hash, ::GetTypeHash(K.RangeStart));
+		Hash = HashCombine(Hash, ::GetTypeHash(K.RangeEnd));
+		return HashCombine(Hash, ::GetTypeHash(K.DetailsMax));
+	}
+};
+
+/**
+ * Merges identical leaderboard downloads that overlap in time.
+ * - The first caller for a key issues DownloadLeaderboardEntries; later callers attach to the pending CCallResult.
+ * - Entries are converted once; every waiter receives the same shared store.
+ * - By default conversion runs on the Steam callback thread. When any waiter asks for a conversion budget,
+ *   rows are converted on the GameThread in slices of at most that many microseconds per frame instead.
+ * - Request() and all completion callbacks run on the GameThread.
+ */
+class STEAMSAL_API FSAL_LeaderboardDownloadCoalescer
+{
+public:
+	using FOnComplete = TFunction<void(bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error)>;
+
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnDownloaded, const FSAL_LeaderboardQueryKey&, const FSAL_LeaderboardEntriesData&);
+
+	static FSAL_LeaderboardDownloadCoalescer& Get();
+
+	/**
+	 * Starts the download for Key, or attaches to one already in flight. Returns false (and fills OutError) if Steam refused the call.
+	 * ConversionBudgetMicroseconds > 0 requests time-sliced conversion; the smallest budget among waiters wins.
+	 */
+	bool Request(const FSAL_LeaderboardQueryKey& Key, FOnComplete OnComplete, FString& OutError,
+	             int32 ConversionBudgetMicroseconds = 0);
+
+	int32 GetNumInFlight() const { return InFlight.Num(); }
+	int32 GetNumCoalesced() const { return NumCoalesced; }
+
+	/** Fires on the GameThread after every successful download, before its waiters run. */
+	FOnDownloaded OnDownloaded;
+
+private:
+	struct FInFlightDownload
+	{
+		TSAL_PendingCall<LeaderboardScoresDownloaded_t> Call;
+		TArray<FOnComplete> Waiters;
+
+		// Written on the GameThread, read on the Steam callback thread.
+		std::atomic<int32> ConversionBudgetMicroseconds{0};
+	};
+
+	TMap<FSAL_LeaderboardQueryKey, TSharedPtr<FInFlightDownload>> InFlight;
+	int32 NumCoalesced = 0;
+
+	void Complete(const FSAL_LeaderboardQueryKey& Key, bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error);
+
+	/** Converts rows on the GameThread, at most BudgetMicroseconds per tick, then completes Key. */
+	void StartSlicedConversion(const FSAL_LeaderboardQueryKey& Key, SteamLeaderboardEntries_t EntriesHandle,
+	                           int32 EntryCount, int32 BudgetMicroseconds);
+};
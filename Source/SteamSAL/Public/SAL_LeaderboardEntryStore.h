@@ -0,0 +1,86 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+/**
+ * Columnar (struct-of-arrays) storage for downloaded leaderboard entries.
+ * - SteamIDs, ranks, scores and UGC handles live in parallel arrays.
+ * - Details of all rows share one pool, addressed by per-row offsets.
+ * - Persona names share one character table, addressed by per-row offset/length.
+ * Blueprint rows (FSAL_LeaderboardEntryRow) are only built when an index is read.
+ */
+class STEAMSAL_API FSAL_LeaderboardEntryStore
+{
+public:
+	FSAL_LeaderboardEntryStore();
+
+	void Reserve(int32 NumRows, int32 NumDetails = 0, int32 NumNameChars = 0);
+
+	/**
+	 * Sizes every column for one Steam download of NumRows entries, so the details pool and name table
+	 * are allocated once per download instead of growing row by row. No details space is reserved when DetailsMax is 0.
+	 */
+	void ReserveForDownload(int32 NumRows, int32 DetailsMax);
+	void Reset();
+
+	int32 AddRow(uint64 SteamID, int32 GlobalRank, int32 Score, uint64 UGCHandle,
+	             const int32* Details, int32 NumDetails, FStringView PlayerName);
+
+	/** Reads entries [FirstIndex, FirstIndex + Count) from a Steam download handle. Returns the number of rows added. */
+	int32 AppendFromSteam(SteamLeaderboardEntries_t EntriesHandle, int32 FirstIndex, int32 Count, int32 DetailsMax);
+
+	/** Appends all rows of another store (names and details are re-pooled). */
+	void Append(const FSAL_LeaderboardEntryStore& Other);
+
+	/** Stable sort by global rank (1 = top). */
+	void SortByGlobalRank();
+
+	int32 Num() const { return SteamIDs.Num(); }
+	bool IsValidIndex(int32 Index) const { return SteamIDs.IsValidIndex(Index); }
+
+	uint64 GetSteamID(int32 Index) const { return SteamIDs[Index]; }
+	int32 GetGlobalRank(int32 Index) const { return GlobalRanks[Index]; }
+	int32 GetScore(int32 Index) const { return Scores[Index]; }
+	uint64 GetUGCHandle(int32 Index) const { return UGCHandles[Index]; }
+
+	TConstArrayView<int32> GetDetails(int32 Index) const;
+	FStringView GetPlayerName(int32 Index) const;
+
+	/** Replaces a row's name. The old characters stay in the table until the store is rebuilt. */
+	void SetPlayerName(int32 Index, FStringView PlayerName);
+
+	TConstArrayView<uint64> GetSteamIDColumn() const { return SteamIDs; }
+	TConstArrayView<int32> GetGlobalRankColumn() const { return GlobalRanks; }
+	TConstArrayView<int32> GetScoreColumn() const { return Scores; }
+	TConstArrayView<uint64> GetUGCHandleColumn() const { return UGCHandles; }
+	TConstArrayView<int32> GetDetailsOffsetsColumn() const { return DetailsOffsets; }
+	TConstArrayView<int32> GetDetailsPool() const { return DetailsPool; }
+
+	void BuildRow(int32 Index, FSAL_LeaderboardEntryRow& OutRow) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+	/** CRC over every column (ids, ranks, scores, UGC, details, names). Equal hashes mean the rows did not change. */
+	uint32 ComputeContentHash() const;
+
+private:
+	TArray<uint64> SteamIDs;
+	TArray<int32> GlobalRanks;
+	TArray<int32> Scores;
+	TArray<uint64> UGCHandles;
+
+	// DetailsOffsets has Num() + 1 items; row i owns DetailsPool[Offsets[i] .. Offsets[i + 1]).
+	TArray<int32> DetailsOffsets;
+	TArray<int32> DetailsPool;
+
+	TArray<int32> NameOffsets;
+	TArray<int32> NameLengths;
+	TArray<TCHAR> NameTable;
+};
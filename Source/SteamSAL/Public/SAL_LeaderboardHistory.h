@@ -0,0 +1,88 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+
+class FArchive;
+
+/**
+ * Append-only archive of one board's snapshots over time ('SALH' files): SteamID, rank and score per row.
+ * - File: 8-byte header (magic, version), then frames. Each frame is varint(PayloadSize) + payload.
+ * - SteamIDs are dictionary-encoded; a frame lists only the IDs it adds to the dictionary.
+ * - A row whose user was in the previous frame stores its rank and score as zigzag varint deltas against that frame,
+ *   so unchanged rows cost about three bytes. Other rows store their rank delta to the previous row and the raw score.
+ * - Frames depend on all earlier frames, so a point in time is rebuilt by streaming from the start.
+ * Details and names are not archived.
+ */
+namespace SAL_History
+{
+	struct FState
+	{
+		TArray<uint64> Dictionary;
+		TMap<uint64, int32> DictionaryLookup;
+
+		// Rank and score of every user in the last frame, by dictionary index.
+		TMap<int32, FIntPoint> Previous;
+
+		int64 LastTimestamp = 0;
+		int32 NumFrames = 0;
+	};
+}
+
+/** Appends snapshots to an archive. Opening restores the encoder state once; each append then costs one encode of the rows. */
+class STEAMSAL_API FSAL_LeaderboardHistoryWriter
+{
+public:
+	/** Opens (or creates) the archive. A torn last frame left by a crash is cut off. */
+	bool Open(const FString& InPath);
+
+	/** Encodes Store (sorted by rank) as a new frame and appends it to the file. */
+	bool Append(const FSAL_LeaderboardEntryStore& Store, int64 TimestampUnix);
+
+	int32 GetNumFrames() const { return State.NumFrames; }
+	int64 GetLastTimestamp() const { return State.LastTimestamp; }
+
+private:
+	FString Path;
+	SAL_History::FState State;
+	bool bOpen = false;
+};
+
+/** Streams frames out of an archive, one at a time. */
+class STEAMSAL_API FSAL_LeaderboardHistoryReader
+{
+public:
+	~FSAL_LeaderboardHistoryReader();
+
+	bool Open(const FString& Path);
+
+	/** Decodes the next frame. False at the end of the archive (or at a torn last frame). */
+	bool Next();
+
+	int64 GetTimestamp() const { return State.LastTimestamp; }
+	int32 GetFrameIndex() const { return State.NumFrames - 1; }
+
+	/** Bytes of the archive consumed so far (header and complete frames). */
+	int64 GetValidSize() const { return ValidSize; }
+
+	/** Rows of the current frame. */
+	int32 Num() const { return SteamIDs.Num(); }
+	void BuildStore(FSAL_LeaderboardEntryStore& Store) const;
+
+	/** Rebuilds the last frame taken at or before TimestampUnix. False if the archive has no such frame. */
+	static bool RebuildAt(const FString& Path, int64 TimestampUnix, FSAL_LeaderboardEntryStore& Store, int64& OutFrameTimestamp);
+
+private:
+	friend class FSAL_LeaderboardHistoryWriter;
+
+	TUniquePtr<FArchive> Reader;
+	SAL_History::FState State;
+	int64 ValidSize = 0;
+
+	TArray<uint64> SteamIDs;
+	TArray<int32> Ranks;
+	TArray<int32> Scores;
+	TArray<uint8> Payload;
+};
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SALTypes.h"
+
+#include "SAL_LeaderboardHistorySubsystem.generated.h"
+
+class FSAL_LeaderboardHistoryWriter;
+
+/**
+ * Named leaderboard history archives under Saved/SteamSAL/History (see FSAL_LeaderboardHistoryWriter for the format).
+ * Feed it the results of 'Download Steam Leaderboard Entries' to chart rank movement over time.
+ * Writers stay open for the session, so appending only encodes the new rows.
+ */
+UCLASS()
+class STEAMSAL_API USAL_LeaderboardHistorySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_LeaderboardHistorySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|History",
+		meta=(DisplayName="Append Leaderboard History",
+			AdvancedDisplay="MinIntervalSeconds",
+			ToolTip="Appends these entries to the named history archive as a snapshot taken now.\nSkipped (returns false) if the last snapshot is younger than MinIntervalSeconds.",
+			Keywords="steam leaderboard history archive season snapshot append chart rank movement"))
+	bool AppendSnapshot(const FString& ArchiveName, const FSAL_LeaderboardEntriesData& EntriesData, float MinIntervalSeconds = 0.0f);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|History",
+		meta=(DisplayName="Get Leaderboard History At",
+			ToolTip="Rebuilds the last snapshot taken at or before TimestampUnix. Rows carry SteamID, rank and score only."))
+	bool GetSnapshotAt(const FString& ArchiveName, int64 TimestampUnix, FSAL_LeaderboardEntriesData& EntriesData, int64& SnapshotTimestampUnix);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|History",
+		meta=(DisplayName="Get Leaderboard History Timestamps"))
+	bool GetSnapshotTimestamps(const FString& ArchiveName, TArray<int64>& TimestampsUnix);
+
+private:
+	TMap<FString, TSharedPtr<FSAL_LeaderboardHistoryWriter>> Writers;
+
+	FString GetArchivePath(const FString& ArchiveName) const;
+	FSAL_LeaderboardHistoryWriter* FindOrOpenWriter(const FString& ArchiveName);
+};
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SALTypes.h"
+#include "SAL_PendingCall.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+#include "SAL_LeaderboardRegistrySubsystem.generated.h"
+
+/**
+ * Remembers which handle and metadata belong to each leaderboard name.
+ * - ResolveBoards() issues FindLeaderboard for every unknown name at once; names already being resolved are shared.
+ * - Handles found here or through the Find/Create nodes are memoized with a metadata snapshot (sort, display, entry count).
+ * - The map is saved under Saved/SteamSAL (one file per AppID), so a warm start resolves known names without a round trip.
+ */
+UCLASS()
+class STEAMSAL_API USAL_LeaderboardRegistrySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	using FOnBoardsResolved = TFunction<void(const TArray<FSAL_LeaderboardInfo>& Found, const TArray<FString>& Missing)>;
+
+	static USAL_LeaderboardRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Resolves every name, querying Steam only for names that are not known yet (or all of them with bForceRefresh).
+	 * OnResolved runs on the GameThread once every name has an answer; it runs immediately if nothing had to be queried.
+	 */
+	void ResolveBoards(const TArray<FString>& LeaderboardNames, bool bForceRefresh, FOnBoardsResolved OnResolved);
+
+	/** Memoizes a handle found elsewhere (e.g. by the Find/Create nodes) and snapshots its metadata. */
+	void Register(const FString& LeaderboardName, FSAL_LeaderboardHandle LeaderboardHandle);
+
+	/** Register() for Steam call-result handlers: may be called from any thread, registers on the GameThread. */
+	static void RecordFromCallback(const UObject* WorldContextObject, const FString& LeaderboardName,
+	                               FSAL_LeaderboardHandle LeaderboardHandle);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Registry",
+		meta=(DisplayName="Find Known Leaderboard",
+			ToolTip="Returns the memoized handle and metadata for this name without contacting Steam. False if the name was never resolved.",
+			Keywords="steam leaderboard registry known cached handle name lookup"))
+	bool FindKnown(const FString& LeaderboardName, FSAL_LeaderboardInfo& Info);
+
+	/**
+	 * Sort method of a handle: Steam's value if the handle was found this session, else the saved snapshot.
+	 * False if neither knows it (Steam's own getter then silently reports Descending).
+	 */
+	bool FindSortMethod(FSAL_LeaderboardHandle LeaderboardHandle, ESALLeaderboardSortMethod& SortMethod);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Registry",
+		meta=(DisplayName="Get Known Leaderboards"))
+	TArray<FSAL_LeaderboardInfo> GetAllKnown();
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Registry",
+		meta=(DisplayName="Refresh Known Leaderboard Info",
+			ToolTip="Re-reads sort method, display type and entry count from Steam for a known leaderboard."))
+	bool RefreshInfo(const FString& LeaderboardName, FSAL_LeaderboardInfo& Info);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Registry",
+		meta=(DisplayName="Forget Known Leaderboard"))
+	void Forget(const FString& LeaderboardName);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Registry",
+		meta=(DisplayName="Clear Leaderboard Registry",
+			ToolTip="Forgets every known leaderboard and deletes the saved registry file."))
+	void ClearRegistry();
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Registry",
+		meta=(ToolTip="Save known leaderboards to disk so later sessions can skip FindLeaderboard for them."))
+	bool bPersistToDisk = true;
+
+private:
+	// Steam leaderboard names are case-sensitive; FString map keys are not by default.
+	template<typename ValueType>
+	struct TCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	struct FPendingFind
+	{
+		TSAL_PendingCall<LeaderboardFindResult_t> Call;
+		TArray<int32> BatchIds;
+	};
+
+	struct FBatch
+	{
+		TArray<FString> Names;
+		int32 NumPending = 0;
+		FOnBoardsResolved OnResolved;
+	};
+
+	TMap<FString, FSAL_LeaderboardInfo, FDefaultSetAllocator, TCaseSensitiveKeyFuncs<FSAL_LeaderboardInfo>> Known;
+	TMap<FString, TSharedPtr<FPendingFind>, FDefaultSetAllocator, TCaseSensitiveKeyFuncs<TSharedPtr<FPendingFind>>> PendingFinds;
+	TMap<int32, FBatch> Batches;
+	int32 NextBatchId = 0;
+
+	bool bLoaded = false;
+	bool bDirty = false;
+
+	void OnFindCompleted(const FString& LeaderboardName, bool bFound, uint64 Handle);
+	void FinishBatch(int32 BatchId);
+	void Snapshot(FSAL_LeaderboardInfo& Info) const;
+
+	FString GetRegistryFilePath() const;
+	void EnsureLoaded();
+	void Save();
+};
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+
+struct FSAL_LeaderboardQueryKey;
+
+/**
+ * On-disk header of a leaderboard snapshot ('SALS' files). All fields are little-endian.
+ * The header is followed by 8-byte aligned columns, in this order:
+ *   uint64 SteamIDs[NumRows], uint64 UGCHandles[NumRows], int32 GlobalRanks[NumRows], int32 Scores[NumRows],
+ *   int32 DetailsOffsets[NumRows + 1], int32 Details[NumDetails],
+ *   int32 NameOffsets[NumRows], int32 NameLengths[NumRows], TCHAR Names[NumNameChars].
+ */
+struct FSAL_LeaderboardSnapshotHeader
+{
+	static constexpr uint32 kMagic = 0x534C4153; // "SALS"
+	static constexpr uint16 kVersion = 1;
+
+	uint32 Magic = kMagic;
+	uint16 Version = kVersion;
+	uint16 CharSize = sizeof(TCHAR);
+	int64 Handle = 0;
+	int64 SavedAtUnix = 0;
+	int32 RequestType = 0;
+	int32 RangeStart = 0;
+	int32 RangeEnd = 0;
+	int32 DetailsMax = 0;
+	int32 NumRows = 0;
+	int32 NumDetails = 0;
+	int32 NumNameChars = 0;
+	uint32 ContentHash = 0;
+};
+
+static_assert(sizeof(FSAL_LeaderboardSnapshotHeader) == 56, "Snapshot header layout changed; bump kVersion.");
+
+/** Serializes entry stores into snapshot bytes. */
+struct STEAMSAL_API FSAL_LeaderboardSnapshotWriter
+{
+	static TArray<uint8> Write(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntryStore& Store, int64 SavedAtUnix);
+};
+
+/**
+ * Read-only view over a snapshot file.
+ * The file is read into one buffer; accessors read straight from its columns, nothing is parsed or allocated per row.
+ */
+class STEAMSAL_API FSAL_LeaderboardSnapshotView
+{
+public:
+	/** Opens and validates a snapshot. Returns null if the file is missing, truncated or of another version. */
+	static TSharedPtr<FSAL_LeaderboardSnapshotView> Open(const FString& Path);
+
+	const FSAL_LeaderboardSnapshotHeader& GetHeader() const { return *Header; }
+
+	int32 Num() const { return Header->NumRows; }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Header->NumRows; }
+
+	uint64 GetSteamID(int32 Index) const { return SteamIDs[Index]; }
+	uint64 GetUGCHandle(int32 Index) const { return UGCHandles[Index]; }
+	int32 GetGlobalRank(int32 Index) const { return GlobalRanks[Index]; }
+	int32 GetScore(int32 Index) const { return Scores[Index]; }
+
+	TConstArrayView<int32> GetDetails(int32 Index) const;
+	FStringView GetPlayerName(int32 Index) const;
+
+	void BuildRow(int32 Index, FSAL_LeaderboardEntryRow& OutRow) const;
+
+	/** Appends every row to Store (one allocation per column). */
+	void CopyTo(FSAL_LeaderboardEntryStore& Store) const;
+
+private:
+	FSAL_LeaderboardSnapshotView() = default;
+
+	bool Bind(const uint8* Data, int64 Size);
+
+	TArray64<uint8> OwnedBytes;
+
+	const FSAL_LeaderboardSnapshotHeader* Header = nullptr;
+	const uint64* SteamIDs = nullptr;
+	const uint64* UGCHandles = nullptr;
+	const int32* GlobalRanks = nullptr;
+	const int32* Scores = nullptr;
+	const int32* DetailsOffsets = nullptr;
+	const int32* Details = nullptr;
+	const int32* NameOffsets = nullptr;
+	const int32* NameLengths = nullptr;
+	const TCHAR* Names = nullptr;
+};
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SALTypes.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+
+#include "SAL_LeaderboardSnapshotSubsystem.generated.h"
+
+class FSAL_LeaderboardSnapshotView;
+
+/**
+ * Keeps the last downloaded state of every leaderboard query on disk (see FSAL_LeaderboardSnapshotHeader).
+ * - Only explicit queries are saved: downloads of the 'Download Steam Leaderboard Entries' node and the cache's
+ *   refreshes. Internal downloads (probes, samples, pages, live windows) never are.
+ * - Each snapshot is serialized on the GameThread and written on a worker thread. Beyond MaxSnapshotFiles the
+ *   least recently written files are deleted.
+ * - A new session or an offline player sees the last known rows without waiting for Steam: the leaderboard cache
+ *   serves them as stale entries on a miss. Loading reads the file once and copies its columns into an entry store
+ *   (one allocation per column); the file is not kept open.
+ */
+UCLASS()
+class STEAMSAL_API USAL_LeaderboardSnapshotSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_LeaderboardSnapshotSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/** Reads the snapshot for Key, or returns null if none was saved. */
+	TSharedPtr<const FSAL_LeaderboardSnapshotView> FindSnapshot(const FSAL_LeaderboardQueryKey& Key);
+
+	/** Copies the snapshot for Key into EntriesData. False if none was saved. */
+	bool LoadEntries(const FSAL_LeaderboardQueryKey& Key, FSAL_LeaderboardEntriesData& EntriesData, int64* OutSavedAtUnix = nullptr);
+
+	/** Writes EntriesData as the snapshot for Key (serialized now, written asynchronously). */
+	void SaveEntries(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData);
+
+	/** SaveEntries if bAutoSnapshot is set. */
+	void AutoSnapshot(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Snapshot",
+		meta=(DisplayName="Get Leaderboard Snapshot",
+			AdvancedDisplay="DetailsMax",
+			ToolTip="Returns the entries saved on disk by the last successful download of this exact query, and when they were saved (Unix seconds).",
+			Keywords="steam leaderboard snapshot offline last known saved disk warm start"))
+	bool GetSnapshotEntries(
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		ELeaderboardRequestType RequestType,
+		int32 RangeStart,
+		int32 RangeEnd,
+		FSAL_LeaderboardEntriesData& EntriesData,
+		int64& SavedAtUnix,
+		int32 DetailsMax = 64);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Snapshot",
+		meta=(DisplayName="Delete Leaderboard Snapshots"))
+	void DeleteAllSnapshots();
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Snapshot",
+		meta=(ToolTip="Write a snapshot after each successful 'Download Steam Leaderboard Entries' and leaderboard cache refresh."))
+	bool bAutoSnapshot = true;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Snapshot",
+		meta=(ToolTip="Snapshot files kept on disk; the least recently written ones are deleted beyond this. 0 or less keeps all."))
+	int32 MaxSnapshotFiles = 64;
+
+private:
+	// Keys whose file is known not to exist, so misses do not hit the disk every frame.
+	TSet<FSAL_LeaderboardQueryKey> KnownMissing;
+
+	FString GetSnapshotDir() const;
+	FString GetSnapshotPath(const FSAL_LeaderboardQueryKey& Key) const;
+};
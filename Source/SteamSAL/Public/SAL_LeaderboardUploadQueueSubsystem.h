@@ -0,0 +1,111 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "SALTypes.h"
+#include "SAL_PendingCall.h"
+
+#include "SAL_LeaderboardUploadQueueSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FSAL_OnQueuedUploadCompleted,
+                                              FSAL_LeaderboardHandle, LeaderboardHandle,
+                                              int32, Score,
+                                              bool, bSuccess,
+                                              int32, NewGlobalRank);
+
+/**
+ * Queues score uploads and sends them one at a time, so bursts of runs do not hit Steam's upload rate limit.
+ * - KeepBestScore: a board keeps at most one pending KeepBest score, the best one in the board's sort method.
+ *   Worse scores are dropped as redundant before they reach Steam. Boards whose sort method is unknown (neither found
+ *   this session nor in the registry) are never merged.
+ * - ForceUpdate: every upload is sent, in the order it was queued. A KeepBest score queued after a pending
+ *   ForceUpdate on the same board is not merged across it.
+ * - The queue is flushed every FlushIntervalSeconds, or at once with FlushNow.
+ * - An upload that fails stays at the head of the queue and the flush stops; the next one waits RetryBackoffSeconds,
+ *   doubling per consecutive failure. Only rejections by Steam count toward MaxUploadAttempts; uploads still queued
+ *   at shutdown are handed to the offline upload journal.
+ */
+UCLASS()
+class STEAMSAL_API USAL_LeaderboardUploadQueueSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_LeaderboardUploadQueueSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Upload",
+		meta=(DisplayName="Queue Steam Leaderboard Score Upload",
+			AdvancedDisplay="Details",
+			AutoCreateRefTerm="Details",
+			ToolTip="Queues a score upload. KeepBest scores are merged per board so only the best one is sent. Listen to OnUploadCompleted for the result.",
+			Keywords="steam leaderboard upload score queue batch rate limit keep best"))
+	void QueueUpload(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score, ESALLeaderboardUploadMethod UploadMethod,
+	                 const TArray<int32>& Details);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Upload",
+		meta=(DisplayName="Flush Leaderboard Upload Queue",
+			ToolTip="Starts sending every queued upload now instead of waiting for the flush interval."))
+	void FlushNow();
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Upload",
+		meta=(DisplayName="Get Leaderboard Upload Queue Stats",
+			ToolTip="Queue depth, uploads dropped as redundant, uploads sent and failed, and the average and last time (seconds) from queueing to Steam's answer."))
+	void GetQueueStats(int32& QueueDepth, int32& DroppedAsRedundant, int32& Uploaded, int32& Failed,
+	                   float& AverageLatencySeconds, float& LastLatencySeconds) const;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Upload")
+	FSAL_OnQueuedUploadCompleted OnUploadCompleted;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Upload",
+		meta=(ToolTip="Seconds between automatic flushes. 0 or less only flushes on FlushNow."))
+	float FlushIntervalSeconds = 5.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Upload",
+		meta=(ToolTip="Seconds before the first retry after a failed upload; doubles per consecutive failure, up to 60 seconds."))
+	float RetryBackoffSeconds = 5.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Upload",
+		meta=(ToolTip="Rejections by Steam after which an upload is reported as failed and dropped. Connection failures never count."))
+	int32 MaxUploadAttempts = 5;
+
+private:
+	struct FQueuedUpload
+	{
+		FSAL_LeaderboardHandle Handle;
+		int32 Score = 0;
+		ESALLeaderboardUploadMethod Method = ESALLeaderboardUploadMethod::KeepBestScore;
+		TArray<int32> Details;
+		double QueuedAt = 0.0;
+		int32 Attempts = 0;
+	};
+
+	TArray<FQueuedUpload> Queue;
+
+	// The upload currently waiting on Steam, if any.
+	TOptional<FQueuedUpload> InFlight;
+	TSAL_PendingCall<LeaderboardScoreUploaded_t> UploadCall;
+
+	bool bFlushing = false;
+	double NextFlushAt = 0.0;
+	FTSTicker::FDelegateHandle TickHandle;
+
+	int32 NumConsecutiveFailures = 0;
+
+	int32 NumDropped = 0;
+	int32 NumUploaded = 0;
+	int32 NumFailed = 0;
+	double TotalLatency = 0.0;
+	double LastLatency = 0.0;
+
+	bool Tick(float DeltaTime);
+	void SendNext();
+	// bRejected: Steam answered m_bSuccess == 0. Otherwise a failure is a transport failure (invalid call, IO).
+	void OnUploaded(bool bOk, bool bRejected, int32 NewGlobalRank, bool bScoreChanged, const FString& Error);
+	void RetryLater(FQueuedUpload Upload);
+};
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Containers/Ticker.h"
+#include "SALTypes.h"
+#include "SAL_PendingCall.h"
+
+#include "SAL_LiveAroundUserWindow.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FSAL_OnAroundUserRowsChanged,
+                                             const TArray<int32>&, ChangedIndices,
+                                             int32, NumRows);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnAroundUserWindowFailure, const FString&, ErrorMessage);
+
+/**
+ * Keeps the local user's GlobalAroundUser slice current for an "around me" panel.
+ * - Every RefreshIntervalSeconds it probes the board cheaply: the entry count plus the user's own entry
+ *   (DownloadLeaderboardEntriesForUsers with one user). If neither changed, the window download is skipped.
+ * - Otherwise the window is downloaded and compared row by row; OnRowsChanged lists only the indices that differ,
+ *   so the UI can patch those rows instead of rebuilding the panel.
+ * - Rows around the user can move without the user's own entry moving; MaxConsecutiveSkips bounds how long
+ *   such changes can go unseen.
+ */
+UCLASS(BlueprintType)
+class STEAMSAL_API USAL_LiveAroundUserWindow : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Live",
+		meta=(WorldContext="WorldContextObject",
+			AdvancedDisplay="DetailsMax",
+			DisplayName="Create Live Around-User Leaderboard Window",
+			Keywords="steam leaderboard around me user live refresh window poll incremental"))
+	static USAL_LiveAroundUserWindow* CreateLiveAroundUserWindow(
+		UObject* WorldContextObject,
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		int32 RowsAbove = 5,
+		int32 RowsBelow = 5,
+		float RefreshIntervalSeconds = 10.0f,
+		int32 DetailsMax = 64);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Live",
+		meta=(ToolTip="Starts refreshing on the cadence. The first refresh runs immediately."))
+	void Start();
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Live")
+	void Stop();
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Live",
+		meta=(ToolTip="Refreshes now. Force skips the probe and always downloads the window."))
+	void RefreshNow(bool bForce = false);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Live")
+	int32 GetNumRows() const { return Data.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Live")
+	bool GetRow(int32 Index, FSAL_LeaderboardEntryRow& Row) const { return Data.GetRow(Index, Row); }
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Live")
+	FSAL_LeaderboardEntriesData GetEntries() const { return Data; }
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Live",
+		meta=(DisplayName="Get Live Window Stats"))
+	void GetStats(int32& Probes, int32& SkippedDownloads, int32& Downloads) const;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Live")
+	FSAL_OnAroundUserRowsChanged OnRowsChanged;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Live")
+	FSAL_OnAroundUserWindowFailure OnFailure;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Live",
+		meta=(ToolTip="Seconds between refreshes while started."))
+	float RefreshIntervalSeconds = 10.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Live",
+		meta=(ToolTip="Unchanged probes in a row after which the window is downloaded anyway. 0 never forces a download."))
+	int32 MaxConsecutiveSkips = 6;
+
+	virtual void BeginDestroy() override;
+
+private:
+	FSAL_LeaderboardHandle Handle{};
+	int32 RowsAbove = 5;
+	int32 RowsBelow = 5;
+	int32 DetailsMax = 64;
+
+	FSAL_LeaderboardEntriesData Data;
+
+	// Last probe result: board size and the user's own entry (rank 0 when not on the board).
+	int32 LastEntryCount = -1;
+	int32 LastOwnRank = -1;
+	int32 LastOwnScore = 0;
+
+	bool bBusy = false;
+	int32 ConsecutiveSkips = 0;
+	double NextRefreshAt = 0.0;
+
+	int32 NumProbes = 0;
+	int32 NumSkipped = 0;
+	int32 NumDownloads = 0;
+
+	TSAL_PendingCall<LeaderboardScoresDownloaded_t> ProbeCall;
+	FTSTicker::FDelegateHandle TickHandle;
+
+	bool Tick(float DeltaTime);
+	void StartProbe();
+	void OnProbed(int32 EntryCount, bool bOk, int32 OwnRank, int32 OwnScore);
+	void DownloadWindow();
+	void OnWindowDownloaded(bool bOk, const FSAL_LeaderboardEntriesData& EntriesData, const FString& Error);
+};
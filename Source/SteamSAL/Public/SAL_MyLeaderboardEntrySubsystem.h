@@ -0,0 +1,74 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SALTypes.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+
+#include "SAL_MyLeaderboardEntrySubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FSAL_OnMyLeaderboardEntryChanged,
+                                               FSAL_LeaderboardHandle, LeaderboardHandle,
+                                               int32, GlobalRank,
+                                               int32, Score);
+
+/**
+ * Remembers the local user's own rank and score per leaderboard, so "your rank" widgets need no extra download.
+ * - Filled from every score upload result (rank from m_nGlobalRankNew) and from any download containing the local user.
+ * - When an upload did not change the stored score, only the rank is refreshed; the score stays unknown until a
+ *   download shows it.
+ * - OnMyEntryChanged fires only when the rank or score actually changed.
+ */
+UCLASS()
+class STEAMSAL_API USAL_MyLeaderboardEntrySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_MyLeaderboardEntrySubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Picks the local user's row out of downloaded entries, if present. */
+	void AddEntries(int64 Handle, const FSAL_LeaderboardEntriesData& EntriesData);
+
+	/** Applies a successful upload. Score is the uploaded score; it is only stored if bScoreChanged. */
+	void RecordUpload(int64 Handle, int32 Score, bool bScoreChanged, int32 NewGlobalRank);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard",
+		meta=(DisplayName="Get My Cached Leaderboard Entry",
+			ToolTip="Returns the local user's last known rank on this board, from uploads and downloads this session.\nHas Score is false if only the rank is known. Returns false if nothing is known yet.",
+			Keywords="steam leaderboard my rank own entry self local user cached"))
+	bool GetMyEntry(
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		int32& GlobalRank,
+		int32& Score,
+		UPARAM(DisplayName="Has Score") bool& bHasScore,
+		float& AgeSeconds) const;
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard",
+		meta=(DisplayName="Clear My Cached Leaderboard Entries"))
+	void ClearMyEntries();
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard")
+	FSAL_OnMyLeaderboardEntryChanged OnMyEntryChanged;
+
+private:
+	struct FMyEntry
+	{
+		int32 GlobalRank = 0;
+		int32 Score = 0;
+		bool bHasScore = false;
+		double UpdatedAt = 0.0;
+	};
+
+	TMap<int64, FMyEntry> Entries;
+
+	FDelegateHandle DownloadedHandle;
+
+	void Update(int64 Handle, int32 GlobalRank, const int32* Score);
+	void OnDownloaded(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData);
+};
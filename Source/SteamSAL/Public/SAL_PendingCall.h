@@ -0,0 +1,57 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+/**
+ * Owns a single CCallResult and forwards its completion to a callback.
+ * Lets one node keep several Steam calls of the same result type in flight.
+ * - The handler runs on the Steam callback thread, like any CCallResult member handler.
+ * - The handler is moved out before it runs, so the owner may release the pending call
+ *   (e.g. from a GameThread task the handler posted) without tearing down the running lambda.
+ */
+template<typename TResult>
+class TSAL_PendingCall
+{
+public:
+	using FHandler = TFunction<void(TResult* Result, bool bIOFailure)>;
+
+	TSAL_PendingCall() = default;
+	TSAL_PendingCall(const TSAL_PendingCall&) = delete;
+	TSAL_PendingCall& operator=(const TSAL_PendingCall&) = delete;
+
+	void Set(SteamAPICall_t ApiCall, FHandler InHandler)
+	{
+		Handler = MoveTemp(InHandler);
+		CallResult.Set(ApiCall, this, &TSAL_PendingCall::OnCompleted);
+	}
+
+	bool IsActive() const
+	{
+		return CallResult.IsActive();
+	}
+
+	void Cancel()
+	{
+		CallResult.Cancel();
+	}
+
+private:
+	void OnCompleted(TResult* Result, bool bIOFailure)
+	{
+		FHandler Local = MoveTemp(Handler);
+
+		if (Local)
+		{
+			Local(Result, bIOFailure);
+		}
+	}
+
+	CCallResult<TSAL_PendingCall, TResult> CallResult;
+	FHandler Handler;
+};
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SALTypes.h"
+#include "SAL_ScoreRankIndex.h"
+
+#include "SAL_PercentileEstimatorSubsystem.generated.h"
+
+/**
+ * Estimates "top X%" for a score from a few single-rank Global downloads instead of the whole board.
+ * - A board's curve is GetLeaderboardEntryCount plus NumSamples ranks spaced densely near the top, where badges are.
+ * - Each estimate then samples inside the gap around the queried score, so the curve sharpens where players actually
+ *   land. Curves (with their refinements) are kept for CurveTTLSeconds.
+ * - Estimates issued while a board's curve is still being sampled wait for that sampling instead of starting another.
+ * - The sort method comes from the leaderboard registry, so restored handles are ordered correctly.
+ */
+UCLASS()
+class STEAMSAL_API USAL_PercentileEstimatorSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	struct FEstimate
+	{
+		int32 Rank = 0;
+		int32 BestRank = 0;
+		int32 WorstRank = 0;
+		int32 TotalEntries = 0;
+		float TopPercent = 0.0f;
+		bool bExact = false;
+		int32 NumRequests = 0;
+	};
+
+	using FOnEstimated = TFunction<void(bool bOk, const FEstimate& Estimate, const FString& Error)>;
+
+	static USAL_PercentileEstimatorSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Estimates the rank and top percentage of Score. OnEstimated runs on the GameThread. */
+	void Estimate(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score, int32 NumSamples, int32 RefineSamples,
+	              FOnEstimated OnEstimated);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Prediction",
+		meta=(DisplayName="Invalidate Leaderboard Percentile Curve",
+			ToolTip="Drops the sampled curve of this leaderboard; the next estimate samples it again."))
+	void InvalidateCurve(FSAL_LeaderboardHandle LeaderboardHandle);
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Prediction",
+		meta=(ToolTip="Seconds a sampled percentile curve is reused before the board is sampled again."))
+	float CurveTTLSeconds = 300.0f;
+
+private:
+	struct FEstimateRequest;
+
+	struct FCurve
+	{
+		FSAL_ScoreRankIndex Index;
+		int32 TotalEntries = 0;
+		double SampledAt = 0.0;
+
+		// True until the base samples land; requests arriving meanwhile wait in Waiting.
+		bool bSampling = true;
+		TArray<TSharedRef<FEstimateRequest>> Waiting;
+
+		explicit FCurve(ESALLeaderboardSortMethod SortMethod)
+			: Index(SortMethod)
+		{
+		}
+	};
+
+	// Everything one Estimate call needs across its sampling rounds.
+	struct FEstimateRequest
+	{
+		FSAL_LeaderboardHandle Handle;
+		int32 Score = 0;
+		int32 RefineSamples = 0;
+		int32 RoundsLeft = 0;
+		int32 NumRequests = 0;
+		TSharedPtr<FCurve> Curve;
+		FOnEstimated OnEstimated;
+	};
+
+	TMap<int64, TSharedPtr<FCurve>> Curves;
+
+	void SampleRanks(const TSharedRef<FEstimateRequest>& Request, const TArray<int32>& Ranks);
+	void OnBaseSampled(const TSharedRef<FEstimateRequest>& Request, bool bAnySample, const FString& Error);
+	void RefineOrFinish(const TSharedRef<FEstimateRequest>& Request);
+	void Finish(const TSharedRef<FEstimateRequest>& Request);
+};
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "SALTypes.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+#include "SAL_PersonaResolverSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnPersonaNamesUpdated, const TArray<FString>&, SteamIDs);
+
+/**
+ * Resolves missing Steam persona names for downloaded leaderboard rows.
+ * - Download nodes hand their entries to Track(); rows with an empty name are queued by SteamID (deduplicated).
+ * - Queued IDs are sent to RequestUserInformation at most MaxRequestsPerSecond.
+ * - PersonaStateChange_t patches the name into every tracked entry store that holds that user,
+ *   so cached and already broadcast EntriesData show the name without a re-download.
+ * - OnNamesUpdated fires at most once per frame with every SteamID patched during that frame.
+ */
+UCLASS()
+class STEAMSAL_API USAL_PersonaResolverSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_PersonaResolverSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Queues every row of EntriesData whose name is still empty. */
+	void Track(const FSAL_LeaderboardEntriesData& EntriesData);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Identity",
+		meta=(DisplayName="Track Leaderboard Persona Names",
+			ToolTip="Requests missing player names for these entries. Names are patched into EntriesData as they arrive; listen to OnNamesUpdated to refresh your UI.",
+			Keywords="steam persona name resolve missing leaderboard player"))
+	void TrackEntries(const FSAL_LeaderboardEntriesData& EntriesData);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Identity",
+		meta=(DisplayName="Get Pending Persona Name Count"))
+	int32 GetNumPending() const;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Identity")
+	FSAL_OnPersonaNamesUpdated OnNamesUpdated;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Identity",
+		meta=(ToolTip="Maximum RequestUserInformation calls issued per second."))
+	float MaxRequestsPerSecond = 20.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Identity",
+		meta=(ToolTip="Seconds to wait for a persona change before a user may be requested again."))
+	float RequestTimeoutSeconds = 30.0f;
+
+private:
+	struct FRowRef
+	{
+		TWeakPtr<FSAL_LeaderboardEntryStore, ESPMode::ThreadSafe> Store;
+		int32 RowIndex = INDEX_NONE;
+	};
+
+	// Users whose name is missing, with every row waiting for it.
+	TMap<uint64, TArray<FRowRef>> Watchers;
+
+	// Not yet sent to Steam, in arrival order.
+	TArray<uint64> Queue;
+	TSet<uint64> Queued;
+
+	// Sent to Steam, with the time of the request.
+	TMap<uint64, double> Requested;
+
+	// Persona changes received since the last tick.
+	TSet<uint64> Changed;
+
+	double RequestTokens = 0.0;
+	FTSTicker::FDelegateHandle TickHandle;
+
+	CCallbackManual<USAL_PersonaResolverSubsystem, PersonaStateChange_t> PersonaStateChangeCallback;
+	void OnPersonaStateChange(PersonaStateChange_t* Change);
+
+	bool Tick(float DeltaTime);
+	void IssueRequests(float DeltaTime);
+	void ExpireRequests();
+	void PatchChangedNames();
+	void Enqueue(uint64 SteamID);
+};
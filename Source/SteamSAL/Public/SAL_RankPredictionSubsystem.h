@@ -0,0 +1,93 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SALTypes.h"
+#include "SAL_LeaderboardDownloadCoalescer.h"
+#include "SAL_ScoreRankIndex.h"
+
+#include "SAL_RankPredictionSubsystem.generated.h"
+
+/**
+ * Predicts leaderboard ranks locally, without a round trip, from every range downloaded this session.
+ * - Each board keeps an FSAL_ScoreRankIndex in its own sort method, fed by the download coalescer. The sort method is
+ *   read from the leaderboard registry on every prediction, so handles restored from its snapshot are ordered
+ *   correctly; boards whose sort method is unknown are not predicted.
+ * - Successful score uploads are applied to the index (see ApplyUpload), and the difference between the last
+ *   prediction and Steam's rank is kept so the UI can show how far off the instant feedback was.
+ */
+UCLASS()
+class STEAMSAL_API USAL_RankPredictionSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_RankPredictionSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Feeds downloaded rows of a board into its index. */
+	void AddEntries(int64 Handle, const FSAL_LeaderboardEntriesData& EntriesData);
+
+	/** Applies the result of a successful upload by SteamID and records the prediction error for that board. */
+	void ApplyUpload(int64 Handle, uint64 SteamID, int32 Score, int32 NewGlobalRank);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Prediction",
+		meta=(DisplayName="Predict Leaderboard Rank",
+			ToolTip="Predicts the global rank this score would get, from the rows downloaded so far.\nExact is true when the neighbouring ranks are cached; otherwise the real rank lies within [Best Rank..Worst Rank].\nReturns false if nothing of this board has been downloaded.",
+			Keywords="steam leaderboard predict rank score estimate instant offline"))
+	bool PredictRank(
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		int32 Score,
+		int32& PredictedRank,
+		int32& BestRank,
+		int32& WorstRank,
+		UPARAM(DisplayName="Is Exact") bool& bExact);
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Prediction",
+		meta=(DisplayName="Get Leaderboard Entries Around Score",
+			ToolTip="Returns the cached entries ranked directly ahead of and behind this score.",
+			Keywords="steam leaderboard around score neighbours adjacent predict"))
+	bool GetEntriesAroundScore(
+		FSAL_LeaderboardHandle LeaderboardHandle,
+		int32 Score,
+		TArray<FSAL_LeaderboardEntryRow>& Entries,
+		int32 NumAhead = 2,
+		int32 NumBehind = 2);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Prediction",
+		meta=(DisplayName="Get Last Rank Prediction Error",
+			ToolTip="Predicted rank minus the rank Steam returned for the last upload to this board. False if no prediction was reconciled yet."))
+	bool GetLastPredictionError(FSAL_LeaderboardHandle LeaderboardHandle, int32& RankError) const;
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Prediction",
+		meta=(DisplayName="Clear Rank Prediction Data"))
+	void ClearPredictionData();
+
+private:
+	struct FBoardState
+	{
+		FSAL_ScoreRankIndex Index;
+		int32 LastPredictedScore = 0;
+		int32 LastPredictedRank = 0;
+		int32 LastError = 0;
+		bool bHasPrediction = false;
+		bool bHasError = false;
+
+		explicit FBoardState(ESALLeaderboardSortMethod SortMethod)
+			: Index(SortMethod)
+		{
+		}
+	};
+
+	TMap<int64, TUniquePtr<FBoardState>> Boards;
+
+	FDelegateHandle DownloadedHandle;
+
+	FBoardState& FindOrAddBoard(int64 Handle);
+	bool UpdateSortMethod(int64 Handle, FBoardState& Board) const;
+	void OnDownloaded(const FSAL_LeaderboardQueryKey& Key, const FSAL_LeaderboardEntriesData& EntriesData);
+};
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+
+/**
+ * Sparse cache of one Global leaderboard, indexed by rank interval.
+ * - Holds disjoint [First..Last] segments sorted by First, each with the rows downloaded for it and its fetch time.
+ *   Segments never overlap, so a sorted array with binary search answers the same queries an interval tree would.
+ * - A segment covers its whole interval even when the board ended early and it holds fewer rows.
+ * - Inserting a segment trims the parts of older segments it overlaps; untouched parts keep their own fetch time.
+ * - Each segment also remembers when it was last assembled, so an owner with a memory budget can evict by LRU.
+ */
+class STEAMSAL_API FSAL_RankRangeIndex
+{
+public:
+	/** Appends to OutGaps every sub-range of [First..Last] not covered by a segment fetched within MaxAgeSeconds. */
+	void GetMissing(int32 First, int32 Last, double MaxAgeSeconds, TArray<FInt32Interval>& OutGaps) const;
+
+	/** Stores Rows (sorted by global rank) as the content of [First..Last], replacing whatever covered that interval. */
+	void Insert(int32 First, int32 Last, const FSAL_LeaderboardEntryStore& Rows);
+
+	/** Copies every cached row with rank in [First..Last] into Out, sorted by rank, and marks those segments as read. */
+	void Assemble(int32 First, int32 Last, FSAL_LeaderboardEntryStore& Out);
+
+	/** Drops segments fetched more than MaxAgeSeconds ago. */
+	void Prune(double MaxAgeSeconds);
+
+	/** Last read time of the least recently read segment. False if the index is empty. */
+	bool GetOldestRead(double& OutLastReadAt) const;
+
+	/** Drops the least recently read segment. */
+	void EvictOldest();
+
+	void Reset() { Segments.Reset(); }
+
+	int32 NumSegments() const { return Segments.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FSegment
+	{
+		int32 First = 0;
+		int32 Last = 0;
+		double FetchedAt = 0.0;
+		double LastReadAt = 0.0;
+		FSAL_LeaderboardEntryStorePtr Rows;
+	};
+
+	TArray<FSegment> Segments;
+
+	/** Index of the first segment whose Last >= Rank. */
+	int32 LowerBound(int32 Rank) const;
+
+	/** Index of the least recently read segment, or INDEX_NONE. */
+	int32 FindOldestRead() const;
+};
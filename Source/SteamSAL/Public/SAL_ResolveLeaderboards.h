@@ -0,0 +1,55 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SALTypes.h"
+
+#include "SAL_ResolveLeaderboards.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FSAL_OnLeaderboardsResolved,
+                                             const TArray<FSAL_LeaderboardInfo>&, Found,
+                                             const TArray<FString>&, Missing);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnResolveLeaderboardsFailure, const FString&, ErrorMessage);
+
+/**
+ * Batch variant of 'Find Steam Leaderboard'.
+ * Names already known to the leaderboard registry (this session or a saved earlier one) resolve without a Steam call;
+ * every other name is looked up in parallel.
+ */
+UCLASS()
+class STEAMSAL_API USAL_ResolveLeaderboards : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboards",
+		meta=(WorldContext="WorldContextObject", BlueprintInternalUseOnly="true", DisplayName="Resolve Steam Leaderboards",
+			AdvancedDisplay="bForceRefresh",
+			ToolTip="Finds several leaderboards at once. Known names are answered from the registry; unknown ones are looked up on Steam in parallel.",
+			Keywords="steam leaderboard find resolve batch many names registry startup"
+		))
+	static USAL_ResolveLeaderboards* ResolveLeaderboards(
+		UObject* WorldContextObject,
+		UPARAM(meta=(ToolTip="Exact leaderboard names (case-sensitive)."))
+		const TArray<FString>& LeaderboardNames,
+		UPARAM(meta=(ToolTip="Look every name up on Steam even if it is already known."))
+		bool bForceRefresh = false);
+
+	UPROPERTY(BlueprintAssignable, meta=(ToolTip="Fires once every name is resolved. Missing lists names Steam did not find."))
+	FSAL_OnLeaderboardsResolved OnCompleted;
+
+	UPROPERTY(BlueprintAssignable)
+	FSAL_OnResolveLeaderboardsFailure OnFailure;
+
+	virtual void Activate() override;
+
+private:
+	UPROPERTY()
+	UObject* WorldContextObject = nullptr;
+
+	TArray<FString> InLeaderboardNames;
+	bool bInForceRefresh = false;
+};
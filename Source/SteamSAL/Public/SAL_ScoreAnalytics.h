@@ -0,0 +1,54 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+
+/**
+ * Score column kernels over FSAL_LeaderboardEntryStore::GetScoreColumn().
+ * - Uses SSE2 on x86 (every Win64 target) and a scalar loop elsewhere; both give identical results.
+ * - Rows from a download are in rank order, so their scores are monotonic: quantiles and threshold lookups
+ *   then use direct indexing and binary search instead of sorting or scanning.
+ */
+struct STEAMSAL_API FSAL_ScoreAnalytics
+{
+	struct FSummary
+	{
+		int32 Count = 0;
+		int32 Min = 0;
+		int32 Max = 0;
+		double Sum = 0.0;
+
+		double GetMean() const { return Count > 0 ? Sum / Count : 0.0; }
+	};
+
+	static FSummary Summarize(TConstArrayView<int32> Scores);
+
+	/** NumBuckets equal-width buckets over [Min..Max]; scores outside the range go to the first or last bucket. */
+	static void Histogram(TConstArrayView<int32> Scores, int32 Min, int32 Max, int32 NumBuckets, TArray<int32>& OutCounts);
+
+	/** Number of scores strictly below / above Threshold. */
+	static int32 CountBelow(TConstArrayView<int32> Scores, int32 Threshold);
+	static int32 CountAbove(TConstArrayView<int32> Scores, int32 Threshold);
+
+	/** True if Scores never decreases, or never increases. bOutAscending tells which (true for fewer than two scores). */
+	static bool IsMonotonic(TConstArrayView<int32> Scores, bool& bOutAscending);
+
+	/**
+	 * Number of scores ranked ahead of a new Score in this sort method. Ties count as ahead, as on Steam.
+	 * Binary search when the column is monotonic, a vector count otherwise.
+	 */
+	static int32 CountAhead(TConstArrayView<int32> Scores, int32 Score, ESALLeaderboardSortMethod SortMethod);
+
+	/** Nearest-rank quantile of each fraction in [0..1], in ascending score order. */
+	static void Quantiles(TConstArrayView<int32> Scores, TConstArrayView<float> Fractions, TArray<int32>& OutScores);
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Times Summarize, Histogram and CountBelow against plain scalar loops on NumRows random scores, and checks that
+	 * both give the same results. Dev builds only; run it with the SAL.BenchmarkScoreAnalytics console command.
+	 */
+	static FString RunBenchmark(int32 NumRows, int32 Iterations);
+#endif
+};
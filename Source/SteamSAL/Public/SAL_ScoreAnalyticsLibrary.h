@@ -0,0 +1,53 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "SALTypes.h"
+
+#include "SAL_ScoreAnalyticsLibrary.generated.h"
+
+/** Blueprint access to FSAL_ScoreAnalytics over the score column of downloaded entries. */
+UCLASS()
+class STEAMSAL_API USAL_ScoreAnalyticsLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Analytics",
+		meta=(DisplayName="Get Leaderboard Score Stats",
+			ToolTip="Count, min, max and mean score of these entries.",
+			Keywords="steam leaderboard score stats min max mean average analytics"))
+	static FSAL_ScoreStats GetScoreStats(const FSAL_LeaderboardEntriesData& EntriesData);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Analytics",
+		meta=(DisplayName="Get Leaderboard Score Histogram",
+			ToolTip="Counts the scores of these entries in NumBuckets equal-width buckets between the lowest and highest score.",
+			Keywords="steam leaderboard score histogram buckets distribution analytics"))
+	static void GetScoreHistogram(
+		const FSAL_LeaderboardEntriesData& EntriesData,
+		int32 NumBuckets,
+		TArray<int32>& Counts,
+		int32& MinScore,
+		int32& MaxScore);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Analytics",
+		meta=(DisplayName="Get Leaderboard Score Quantiles",
+			ToolTip="Returns the score at each fraction (0 = lowest score, 0.5 = median, 1 = highest score) of these entries.",
+			Keywords="steam leaderboard score quantile percentile median band analytics"))
+	static void GetScoreQuantiles(
+		const FSAL_LeaderboardEntriesData& EntriesData,
+		const TArray<float>& Fractions,
+		TArray<int32>& Scores);
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Analytics",
+		meta=(DisplayName="Get Top Percent For Score",
+			ToolTip="How many of these entries rank ahead of (or tie with) Score, and that count as a percentage of the entries.\nUse with a Global download of the whole board for a 'top X%' badge.",
+			Keywords="steam leaderboard top percent badge threshold rank ahead analytics"))
+	static float GetTopPercentForScore(
+		const FSAL_LeaderboardEntriesData& EntriesData,
+		int32 Score,
+		ESALLeaderboardSortMethod SortMethod,
+		int32& NumAhead);
+};
@@ -0,0 +1,84 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SALTypes.h"
+
+/**
+ * Order-statistic view of the parts of one board that have been downloaded: (rank, score, SteamID) points
+ * sorted by rank, so scores are monotonic in the board's sort method.
+ * - PredictRank answers "which rank would score X get" with one binary search. The answer is exact when the
+ *   neighbouring cached ranks are consecutive; otherwise it is an estimate with a [BestRank..WorstRank] bound.
+ * - Ties rank behind existing entries, like Steam (earlier scores win).
+ * - The point of the excluded user (usually the local one) is looked up once after each change, so repeated
+ *   predictions stay O(log n).
+ */
+class STEAMSAL_API FSAL_ScoreRankIndex
+{
+public:
+	struct FPrediction
+	{
+		int32 Rank = 0;
+		int32 BestRank = 0;
+		int32 WorstRank = 0;
+		bool bExact = false;
+	};
+
+	explicit FSAL_ScoreRankIndex(ESALLeaderboardSortMethod InSortMethod = ESALLeaderboardSortMethod::Descending)
+		: SortMethod(InSortMethod)
+	{
+	}
+
+	/** Merges downloaded rows. Cached points in the rows' rank span, or belonging to the same users, are replaced. */
+	void Insert(const FSAL_LeaderboardEntryStore& Rows);
+
+	/**
+	 * Applies an upload result: the user's old point is removed and the user is inserted at NewRank,
+	 * shifting the cached ranks in between.
+	 */
+	void ApplyUpload(uint64 SteamID, int32 Score, int32 NewRank);
+
+	/**
+	 * Predicts the rank of Score on a board of TotalEntries entries. ExcludeSteamID (usually the local user)
+	 * is ignored, since a new score replaces that user's old entry. False if nothing is cached.
+	 */
+	bool PredictRank(int32 Score, int32 TotalEntries, uint64 ExcludeSteamID, FPrediction& Out) const;
+
+	/** Indices of up to NumAbove cached points ranked ahead of Score and NumBelow behind it, in rank order. */
+	void GetAdjacent(int32 Score, int32 NumAbove, int32 NumBelow, TArray<int32>& OutIndices) const;
+
+	int32 Num() const { return Ranks.Num(); }
+	int32 GetRank(int32 Index) const { return Ranks[Index]; }
+	int32 GetScore(int32 Index) const { return Scores[Index]; }
+	uint64 GetSteamID(int32 Index) const { return SteamIDs[Index]; }
+
+	ESALLeaderboardSortMethod GetSortMethod() const { return SortMethod; }
+
+	/** Points are kept in rank order whatever the sort method, so only score comparisons change. */
+	void SetSortMethod(ESALLeaderboardSortMethod InSortMethod) { SortMethod = InSortMethod; }
+
+private:
+	ESALLeaderboardSortMethod SortMethod;
+
+	TArray<int32> Ranks;
+	TArray<int32> Scores;
+	TArray<uint64> SteamIDs;
+
+	/** True if A ranks strictly ahead of B. */
+	bool IsBetter(int32 A, int32 B) const
+	{
+		return SortMethod == ESALLeaderboardSortMethod::Descending ? A > B : A < B;
+	}
+
+	/** Index of the first point a new Score would rank ahead of (ties stay ahead of it). */
+	int32 FindInsertIndex(int32 Score) const;
+
+	/** Index of SteamID's point, or INDEX_NONE. The last answer is kept until the points change. */
+	int32 FindSteamID(uint64 SteamID) const;
+
+	mutable uint64 LookupSteamID = 0;
+	mutable int32 LookupIndex = INDEX_NONE;
+
+	void RemoveAt(int32 Index);
+};
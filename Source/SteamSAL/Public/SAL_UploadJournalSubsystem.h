@@ -0,0 +1,152 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "SALTypes.h"
+#include "SAL_PendingCall.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+#include "SAL_UploadJournalSubsystem.generated.h"
+
+class IFileHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FSAL_OnJournaledUploadReplayed,
+                                               const FString&, LeaderboardName,
+                                               int32, Score,
+                                               bool, bSuccess);
+
+/**
+ * Keeps score uploads that could not reach Steam in an append-only journal and replays them later.
+ * - The upload nodes journal an upload when Steam is unavailable, refuses the call or the call fails with an IO error.
+ *   Entries hold the board name (handles do not survive a session), score, method, details and, for UGC uploads,
+ *   a copy of the payload under the journal directory.
+ * - Records and UGC payloads are written at once and fsynced in batches every FsyncIntervalSeconds, so journaling
+ *   costs the GameThread buffered writes only. Each record is length- and CRC-framed; a torn tail from a crash is ignored.
+ * - Each Steam account has its own journal under Saved/SteamSAL/Journal/<AppID>/<SteamID>; nothing is journaled
+ *   (JournalUpload returns false) until Steam reports a signed-in user.
+ * - The journal is replayed at startup and on SteamServersConnected_t, at most MaxConcurrentReplays at a time and
+ *   one at a time per board, in journal order. Only rejections by Steam count toward MaxReplayAttempts.
+ *   Acknowledged entries are appended as acks and the file is compacted once enough of them pile up.
+ */
+UCLASS()
+class STEAMSAL_API USAL_UploadJournalSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USAL_UploadJournalSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Journals an upload of LeaderboardHandle for replay. UGCData, if not empty, is kept next to the journal.
+	 * Returns false if the record is not on disk: no signed-in Steam user, a write error, or the board's name cannot
+	 * be determined (it must have been found by name this or a previous session).
+	 */
+	bool JournalUpload(FSAL_LeaderboardHandle LeaderboardHandle, int32 Score, ESALLeaderboardUploadMethod UploadMethod,
+	                   const TArray<int32>& Details, const FString& UGCFileName = FString(),
+	                   const TArray<uint8>& UGCData = TArray<uint8>());
+
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard|Upload",
+		meta=(DisplayName="Replay Offline Leaderboard Uploads",
+			ToolTip="Sends journaled uploads now instead of waiting for Steam to reconnect."))
+	void ReplayNow();
+
+	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard|Upload",
+		meta=(DisplayName="Get Offline Leaderboard Upload Count"))
+	int32 GetNumPendingUploads() const { return Entries.Num(); }
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|Upload")
+	FSAL_OnJournaledUploadReplayed OnUploadReplayed;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Upload",
+		meta=(ToolTip="Seconds between fsyncs of newly journaled uploads."))
+	float FsyncIntervalSeconds = 0.5f;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Upload",
+		meta=(ToolTip="Journaled uploads sent to Steam at the same time during a replay."))
+	int32 MaxConcurrentReplays = 2;
+
+	UPROPERTY(BlueprintReadWrite, Category="SteamSAL|Leaderboard|Upload",
+		meta=(ToolTip="Rejections by Steam after which an upload is dropped from the journal. Connection failures never count."))
+	int32 MaxReplayAttempts = 5;
+
+private:
+	struct FEntry
+	{
+		uint32 Id = 0;
+		FString LeaderboardName;
+		int32 Score = 0;
+		ESALLeaderboardUploadMethod Method = ESALLeaderboardUploadMethod::KeepBestScore;
+		TArray<int32> Details;
+		FString UGCFileName;
+		FString UGCPayloadPath;
+
+		// Not persisted: rejections by Steam this session.
+		int32 Attempts = 0;
+	};
+
+	struct FReplay
+	{
+		FEntry Entry;
+		FSAL_LeaderboardHandle Handle;
+		FSAL_UGCHandle UGCHandle;
+		TSAL_PendingCall<RemoteStorageFileWriteAsyncComplete_t> WriteCall;
+		TSAL_PendingCall<RemoteStorageFileShareResult_t> ShareCall;
+		TSAL_PendingCall<LeaderboardScoreUploaded_t> UploadCall;
+		TSAL_PendingCall<LeaderboardUGCSet_t> AttachCall;
+	};
+
+	// Pending entries in journal order.
+	TArray<FEntry> Entries;
+	TMap<uint32, TUniquePtr<FReplay>> Replays;
+	TArray<uint32> ReplayQueue;
+
+	uint32 NextId = 1;
+	int32 NumAcksSinceCompaction = 0;
+
+	// Journal directory of the Steam user whose entries are loaded. Empty until Steam is up.
+	FString LoadedDir;
+
+	TUniquePtr<IFileHandle> Journal;
+
+	// UGC payloads written since the last fsync, by entry id; flushed and closed together with the journal.
+	TMap<uint32, TUniquePtr<IFileHandle>> UnsyncedPayloads;
+	bool bStartingReplays = false;
+	bool bStartupReplayDone = false;
+	bool bNeedsFsync = false;
+	double NextFsyncAt = 0.0;
+	FTSTicker::FDelegateHandle TickHandle;
+
+	CCallbackManual<USAL_UploadJournalSubsystem, SteamServersConnected_t> ServersConnectedCallback;
+	void OnServersConnected(SteamServersConnected_t* Connected);
+
+	bool Tick(float DeltaTime);
+	void Fsync();
+
+	static void SerializeEntry(FArchive& Ar, FEntry& Entry);
+
+	FString GetJournalDir() const;
+	bool EnsureLoadedForCurrentUser();
+	void Load();
+	bool OpenJournal();
+	bool AppendRecord(const TArray<uint8>& Payload);
+	void Compact();
+
+	void StartNextReplays();
+	bool IsBoardReplaying(const FString& LeaderboardName) const;
+	void StartReplay(const FEntry& Entry);
+	void ReplayWrite(uint32 Id);
+	void ReplayShare(uint32 Id);
+	void ReplayUpload(uint32 Id);
+	void ReplayAttach(uint32 Id);
+	void FinishReplay(uint32 Id, bool bOk, bool bRetry, const FString& Error);
+	void Acknowledge(uint32 Id);
+};
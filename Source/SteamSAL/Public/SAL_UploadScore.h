@@ -11,7 +11,11 @@ THIRD_PARTY_INCLUDES_END
 #include "SAL_UploadScore.generated.h"
 
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSAL_UploadScoreSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FSAL_UploadScoreSuccess,
+                                              int32, Score,
+                                              bool, bScoreChanged,
+                                              int32, NewGlobalRank,
+                                              int32, PreviousGlobalRank);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_UploadScoreFailure, FString, ErrorMessage);
 
@@ -27,7 +31,7 @@ public:
 			BlueprintInternalUseOnly="true",
 			AdvancedDisplay="Details",
 			AutoCreateRefTerm="Details",
-			ToolTip="Uploads a score with optional Details (up to 64 ints)."))
+			ToolTip="Uploads a score with optional Details (up to 64 ints).\nOnSuccess reports your new and previous global rank; Score Changed is false if a Keep Best upload did not beat your stored score."))
 	static USAL_UploadScore* UploadScore(
 		UObject* WorldContextObject,
 		FSAL_LeaderboardHandle LeaderboardHandle,
@@ -52,4 +56,7 @@ private:
 
 	CCallResult<USAL_UploadScore, LeaderboardScoreUploaded_t> UploadCallResult;
 	void OnUploadCompleted(LeaderboardScoreUploaded_t* Result, bool bIOFailure);
+
+	// Journals the upload for replay when Steam comes back, then reports the failure. GameThread only.
+	void FailAndJournal(const FString& Why);
 };
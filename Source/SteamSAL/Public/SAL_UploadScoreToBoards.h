@@ -0,0 +1,84 @@
+// Copyright (c) 2025 UnForge. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "SALTypes.h"
+#include "SAL_PendingCall.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "steam/steam_api.h"
+THIRD_PARTY_INCLUDES_END
+
+#include "SAL_UploadScoreToBoards.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+	FSAL_OnUploadScoreToBoardsSuccess,
+	const TArray<FSAL_UploadScoreResult>&, Results,
+	int32, NumSucceeded
+);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+	FSAL_OnUploadScoreToBoardsFailure,
+	const FString&, Error,
+	const TArray<FSAL_UploadScoreResult>&, Results
+);
+
+/**
+ * Uploads one score to several leaderboards at once (e.g. global, weekly, per-map).
+ * - Every UploadLeaderboardScore call is issued up front, so the node takes one round trip instead of one per board.
+ * - Results has one entry per (deduplicated) board, in input order, with its new and previous global rank.
+ * OnSuccess fires if at least one board accepted the score; check each result's bOk for partial failures.
+ * Boards that could not reach Steam are journaled for replay like 'Upload Steam Leaderboard Score'.
+ */
+UCLASS()
+class STEAMSAL_API USAL_UploadScoreToBoards : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard",
+		meta=(WorldContext="WorldContextObject",
+			BlueprintInternalUseOnly="true",
+			AdvancedDisplay="Details",
+			AutoCreateRefTerm="Details",
+			DisplayName="Upload Steam Leaderboard Score (Multiple Boards)",
+			ToolTip="Uploads the same score with optional Details (up to 64 ints) to every leaderboard in the list concurrently.",
+			Keywords="steam leaderboard upload score multiple boards fan out weekly map character batch"))
+	static USAL_UploadScoreToBoards* UploadScoreToBoards(
+		UObject* WorldContextObject,
+		const TArray<FSAL_LeaderboardHandle>& LeaderboardHandles,
+		int32 Score,
+		ESALLeaderboardUploadMethod UploadMethod,
+		const TArray<int32>& Details);
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="Fires once every board has answered and at least one accepted the score."))
+	FSAL_OnUploadScoreToBoardsSuccess OnSuccess;
+
+	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard",
+		meta=(ToolTip="Fires if the upload could not start or every board failed."))
+	FSAL_OnUploadScoreToBoardsFailure OnFailure;
+
+	virtual void Activate() override;
+
+private:
+	UPROPERTY()
+	UObject* WorldContextObject = nullptr;
+
+	TArray<FSAL_LeaderboardHandle> InHandles;
+	int32 InScore = 0;
+	ESALLeaderboardUploadMethod InUploadMethod = ESALLeaderboardUploadMethod::KeepBestScore;
+	TArray<int32> InDetails;
+
+	TArray<FSAL_UploadScoreResult> Results;
+	TArray<TUniquePtr<TSAL_PendingCall<LeaderboardScoreUploaded_t>>> Calls;
+	int32 NumPending = 0;
+
+	void IssueUpload(int32 BoardIndex);
+	// bJournal: the board could not reach Steam, so the upload is kept for replay.
+	void OnBoardDone(int32 BoardIndex, const FSAL_UploadScoreResult& Result, bool bJournal);
+	void Finish();
+	void Fail(const FString& Why);
+};
@@ -19,6 +19,15 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FSAL_OnUploadScoreWithUGCSuccess,
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSAL_OnUploadScoreWithUGCFailure,
                                             const FString&, ErrorMessage);
 
+/**
+ * Uploads a score and attaches a UGC file to it.
+ * - The payload is written with FileWriteAsync, so the GameThread never blocks on Remote Storage.
+ * - The score upload runs alongside the write and share; only AttachLeaderboardUGC waits for both.
+ * - A Keep Best upload that did not beat the stored score never attaches: the stored entry keeps its own UGC and
+ *   OnSuccess reports an invalid UGC handle.
+ * - In score-first mode the score is uploaded alone first, and a Keep Best upload that did not beat the stored
+ *   score finishes without writing the file, saving bandwidth and cloud quota. Costs one extra round trip otherwise.
+ */
 UCLASS()
 class STEAMSAL_API USAL_UploadScoreWithUGC : public UBlueprintAsyncActionBase
 {
@@ -29,9 +38,10 @@ public:
 		meta=(WorldContext="WorldContextObject",
 			BlueprintInternalUseOnly="true",
 			ToolTip=
-			"Upload a score to a Steam leaderboard and attach a UGC file in a single call.\n The node will:\n- Write the UGC data to Steam Remote Storage\n- Share the file to obtain a UGC handle\n- Upload the score\n- Attach the UGC handle to the uploaded score."
+			"Upload a score to a Steam leaderboard and attach a UGC file in a single call.\n The node will:\n- Write the UGC data to Steam Remote Storage (asynchronously) and share it to obtain a UGC handle\n- Upload the score at the same time\n- Attach the UGC handle to the uploaded score once both are done."
 			,
 			AutoCreateRefTerm = "Details,UGCData",
+			AdvancedDisplay="UploadMethod,bScoreFirst",
 			Keywords="steam leaderboard upload score ugc file remote storage attach"),
 		DisplayName="Upload Steam Leaderboard Score With UGC")
 	static USAL_UploadScoreWithUGC* UploadScoreWithUGC(
@@ -48,7 +58,11 @@ public:
 			meta=(ToolTip=
 				"Binary contents to write into the UGC file. Use a separate conversion node if you want to send text/JSON."
 			))
-		TArray<uint8> UGCData
+		TArray<uint8> UGCData,
+		UPARAM(meta=(ToolTip="Keep Best only replaces the stored score if the new one is better."))
+		ESALLeaderboardUploadMethod UploadMethod = ESALLeaderboardUploadMethod::KeepBestScore,
+		UPARAM(DisplayName="Score First", meta=(ToolTip="Upload the score before the file, and skip the file if a Keep Best score did not improve. UGC Handle is then invalid on success."))
+		bool bScoreFirst = false
 	);
 
 	UPROPERTY(BlueprintAssignable, Category="SteamSAL|Leaderboard|UGC")
@@ -68,20 +82,42 @@ private:
 	TArray<int32> InDetails;
 	FString InUGCFileName;
 	TArray<uint8> InUGCData;
+	ESALLeaderboardUploadMethod InUploadMethod = ESALLeaderboardUploadMethod::KeepBestScore;
+	bool bInScoreFirst = false;
 
 	FSAL_UGCHandle SharedUGCHandle;
 
+	// Join state of the two branches (write -> share, and score upload). GameThread only.
+	bool bScoreUploaded = false;
+	bool bScoreChanged = false;
+	bool bFileShared = false;
+	bool bFinished = false;
+	FString ShareError;
+
+	CCallResult<USAL_UploadScoreWithUGC, RemoteStorageFileWriteAsyncComplete_t> FileWriteCallResult;
 	CCallResult<USAL_UploadScoreWithUGC, RemoteStorageFileShareResult_t> FileShareCallResult;
 	CCallResult<USAL_UploadScoreWithUGC, LeaderboardScoreUploaded_t> ScoreUploadedCallResult;
 	CCallResult<USAL_UploadScoreWithUGC, LeaderboardUGCSet_t> AttachUGCCallResult;
 
+	void StartFileWrite();
 	void StartFileShare();
 	void StartUploadScore();
 	void StartAttachUGC();
 
+	void OnFileWritten(RemoteStorageFileWriteAsyncComplete_t* Callback, bool bIOFailure);
 	void OnFileShared(RemoteStorageFileShareResult_t* Callback, bool bIOFailure);
 	void OnScoreUploaded(LeaderboardScoreUploaded_t* Callback, bool bIOFailure);
 	void OnUGCAttached(LeaderboardUGCSet_t* Callback, bool bIOFailure);
 
+	// Called on the GameThread when either branch finished; attaches once both have.
+	void OnBranchDone();
+	void FailShare(const FString& Why);
+
+	// Keep Best upload that did not beat the stored score: succeeds without touching the entry's UGC.
+	void FinishWithoutUGC();
+
 	void Fail(const FString& Why);
+
+	// Journals score and payload for replay when Steam comes back, then fails. Safe to call from Steam callbacks.
+	void FailAndJournal(const FString& Why);
 };
@@ -317,6 +317,18 @@ public:
 		bool& bHasUGC,
 		FSAL_UGCHandle& UGCHandle);
 
+	UFUNCTION(BlueprintCallable, Category="SteamSAL|Leaderboard",
+		meta=(
+			DisplayName="Get All Downloaded Leaderboard Entries",
+			ToolTip=
+			"Builds every row of EntriesData as an array. Prefer 'Get Downloaded Leaderboard Entry' for large downloads; rows are only materialized when read."
+			,
+			Keywords="steam leaderboard get downloaded entries rows all array"
+		))
+	static void GetAllDownloadedLeaderboardEntries(
+		const FSAL_LeaderboardEntriesData& EntriesData,
+		TArray<FSAL_LeaderboardEntryRow>& Rows);
+
 	UFUNCTION(BlueprintPure, Category="SteamSAL|Leaderboard",
 	meta=(
 		DisplayName="Format Leaderboard Score",